@@ -0,0 +1,168 @@
+#include <stdint.h>
+#include <string.h>
+#include "byte_scan.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SCAN_X86
+#include <immintrin.h>
+#endif
+
+#define ONES ((uint64_t)0x0101010101010101)
+#define HIGH ((uint64_t)0x8080808080808080)
+
+/* Nonzero if any byte of x is below 0x20 or above 0x7e. */
+#define HASCTL(x) \
+    (((((x) - ONES * 0x20) & ~(x)) | ((x) + ONES * 0x01) | (x)) & HIGH)
+
+static size_t
+ascii_scalar(const char *s, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8){
+        uint64_t x;
+        memcpy(&x, s + i, sizeof(x));
+        if (x & HIGH)
+            break;
+    }
+    while (i < n && !(s[i] & 0x80))
+        i++;
+    return i;
+}
+
+static size_t
+scan_scalar(const char *s, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8){
+        uint64_t x;
+        memcpy(&x, s + i, sizeof(x));
+        if (HASCTL(x))
+            break;
+    }
+    for (; i < n; i++){
+        unsigned char b = (unsigned char)s[i];
+        if (b < 0x20 || b >= 0x7f)
+            break;
+    }
+    return i;
+}
+
+#ifdef SCAN_X86
+/* Bytes are compared as signed, so anything >= 0x80 is negative and
+ * falls under the "less than 0x20" test along with the C0 controls.
+ */
+__attribute__((target("sse2")))
+static size_t
+scan_sse2(const char *s, size_t n)
+{
+    const __m128i sp = _mm_set1_epi8(0x20);
+    const __m128i del = _mm_set1_epi8(0x7f);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16){
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i b = _mm_or_si128(_mm_cmplt_epi8(v, sp), _mm_cmpeq_epi8(v, del));
+        int m = _mm_movemask_epi8(b);
+        if (m)
+            return i + (size_t)__builtin_ctz((unsigned)m);
+    }
+    return i + scan_scalar(s + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static size_t
+scan_avx2(const char *s, size_t n)
+{
+    const __m256i sp = _mm256_set1_epi8(0x20);
+    const __m256i del = _mm256_set1_epi8(0x7f);
+    size_t i = 0;
+
+    for (; i + 32 <= n; i += 32){
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i b = _mm256_or_si256(_mm256_cmpgt_epi8(sp, v),
+                                    _mm256_cmpeq_epi8(v, del));
+        unsigned m = (unsigned)_mm256_movemask_epi8(b);
+        if (m)
+            return i + (size_t)__builtin_ctz(m);
+    }
+    return i + scan_sse2(s + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static size_t
+ascii_sse2(const char *s, size_t n)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16){
+        int m = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s + i)));
+        if (m)
+            return i + (size_t)__builtin_ctz((unsigned)m);
+    }
+    return i + ascii_scalar(s + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static size_t
+ascii_avx2(const char *s, size_t n)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= n; i += 32){
+        __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+        unsigned m = (unsigned)_mm256_movemask_epi8(v);
+        if (m)
+            return i + (size_t)__builtin_ctz(m);
+    }
+    return i + ascii_sse2(s + i, n - i);
+}
+#endif
+
+static size_t text_init(const char *s, size_t n);
+static size_t ascii_init(const char *s, size_t n);
+static size_t (*scan_text_fn)(const char *s, size_t n) = text_init;
+static size_t (*scan_ascii_fn)(const char *s, size_t n) = ascii_init;
+
+static void
+scan_select(void)
+{
+#ifdef SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")){
+        scan_text_fn = scan_avx2;
+        scan_ascii_fn = ascii_avx2;
+    } else{
+        scan_text_fn = scan_sse2;
+        scan_ascii_fn = ascii_sse2;
+    }
+#else
+    scan_text_fn = scan_scalar;
+    scan_ascii_fn = ascii_scalar;
+#endif
+}
+
+static size_t
+text_init(const char *s, size_t n)
+{
+    scan_select();
+    return scan_text_fn(s, n);
+}
+
+static size_t
+ascii_init(const char *s, size_t n)
+{
+    scan_select();
+    return scan_ascii_fn(s, n);
+}
+
+size_t
+scan_text(const char *s, size_t n)
+{
+    return scan_text_fn(s, n);
+}
+
+size_t
+scan_ascii(const char *s, size_t n)
+{
+    return scan_ascii_fn(s, n);
+}
@@ -0,0 +1,12 @@
+#ifndef TMT_BYTE_SCAN_H
+#define TMT_BYTE_SCAN_H
+
+#include <stddef.h>
+
+/* Length of the leading run of printable ASCII (0x20-0x7e) in s. */
+size_t scan_text(const char *s, size_t n);
+
+/* Length of the leading run of 7-bit ASCII (0x00-0x7f) in s. */
+size_t scan_ascii(const char *s, size_t n);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef TMT_CELL_H
+#define TMT_CELL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "tmt.h"
+
+/* Cells and renditions, as tmt.c and render.c both look at them. */
+#define MAX(x, y) (((size_t)(x) > (size_t)(y)) ? (size_t)(x) : (size_t)(y))
+#define MIN(x, y) (((size_t)(x) < (size_t)(y)) ? (size_t)(x) : (size_t)(y))
+#define SAMECHAR(ch, w, s, t) ((ch)->c == (tmt_wchar_t)(w) && (ch)->style == (s) && \
+                               !(ch)->marks && (ch)->char_type == (t))
+#define BLANK(ch) SAMECHAR(ch, L' ', 0, TMT_HALFWIDTH)
+#define SAMECELL(a, b) ((a)->c == (b)->c && (a)->style == (b)->style && \
+                        (a)->marks == (b)->marks && (a)->char_type == (b)->char_type)
+
+static const TMTATTRS defattrs = {.fg = {TMT_COLOR_DEFAULT},
+                                  .bg = {TMT_COLOR_DEFAULT}};
+
+/* The red, green and blue of a color only count if it's TMT_COLOR_RGB;
+ * SGR leaves them behind when switching to another one.
+ */
+static inline bool
+samecolor(tmt_color_t a, tmt_color_t b)
+{
+    return a.code == b.code && (a.code != TMT_COLOR_RGB ||
+           (a.red == b.red && a.green == b.green && a.blue == b.blue));
+}
+
+static inline bool
+sameattrs(const TMTATTRS *a, const TMTATTRS *b)
+{
+    return a->bold == b->bold && a->dim == b->dim &&
+           a->underline == b->underline && a->blink == b->blink &&
+           a->reverse == b->reverse && a->invisible == b->invisible &&
+           samecolor(a->fg, b->fg) && samecolor(a->bg, b->bg);
+}
+
+#endif
@@ -0,0 +1,453 @@
+#ifdef TMT_HAS_MMAP
+#define _POSIX_C_SOURCE 200809L /* for ftruncate, pwrite and fileno */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "history.h"
+
+#ifdef TMT_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#define HOT_SEGS 2   /* newest segments left uncompressed */
+#define LZ_HASH  12
+#define LZ_MIN   4
+
+#define SEG(h, i) (&(h)->segs[((h)->head + (i)) % (h)->cap])
+#define SPILL(h, i) ((h)->spill[((h)->shead + (i)) % (h)->spcap])
+
+/* A spilled segment in the file: this header, then its data, padded to
+ * keep the next header aligned.
+ */
+struct spill_hdr{
+    uint64_t seq;
+    uint32_t n, rawlen, len, packed;
+    uint32_t off[HIST_SEG_LINES + 1];
+};
+
+/**** BLOCK COMPRESSION
+ * A byte-oriented LZ77 in the style of LZ4: a series of sequences, each
+ * a token byte (literal count in the high nibble, match length - 4 in
+ * the low, 15 meaning more bytes follow), the literals, and a two-byte
+ * offset and any extra length bytes for the match. The last sequence
+ * has literals only. Scrollback is full of repeated prompts, paths and
+ * padding, which this catches cheaply.
+ */
+#define LZ_BOUND(n) ((n) + (n) / 255 + 16)
+
+static unsigned char *
+lz_len(unsigned char *o, size_t n)
+{
+    for (; n >= 255; n -= 255)
+        *o++ = 255;
+    *o++ = (unsigned char)n;
+    return o;
+}
+
+static unsigned char *
+lz_emit(unsigned char *o, const unsigned char *lit, size_t nlit,
+        size_t off, size_t mlen)
+{
+    size_t m = mlen? mlen - LZ_MIN : 0;
+    *o++ = (unsigned char)((nlit < 15? nlit : 15) << 4 | (m < 15? m : 15));
+    if (nlit >= 15) o = lz_len(o, nlit - 15);
+    memcpy(o, lit, nlit);
+    o += nlit;
+    if (mlen){
+        *o++ = (unsigned char)off;
+        *o++ = (unsigned char)(off >> 8);
+        if (m >= 15) o = lz_len(o, m - 15);
+    }
+    return o;
+}
+
+static size_t
+lz_pack(unsigned char *dst, const unsigned char *src, size_t n)
+{
+    uint32_t tab[1 << LZ_HASH] = {0};
+    unsigned char *o = dst;
+    size_t lit = 0, i = 0;
+
+    while (i + LZ_MIN <= n){
+        uint32_t x;
+        memcpy(&x, src + i, sizeof(x));
+        size_t hv = (x * 2654435761U) >> (32 - LZ_HASH);
+        size_t ref = tab[hv];
+        tab[hv] = (uint32_t)i;
+        if (ref < i && i - ref <= 0xffff && memcmp(src + ref, src + i, LZ_MIN) == 0){
+            size_t len = LZ_MIN;
+            while (i + len < n && src[ref + len] == src[i + len])
+                len++;
+            o = lz_emit(o, src + lit, i - lit, i - ref, len);
+            i += len;
+            lit = i;
+        } else
+            i++;
+    }
+    o = lz_emit(o, src + lit, n - lit, 0, 0);
+    return (size_t)(o - dst);
+}
+
+static bool
+lz_getlen(const unsigned char **s, const unsigned char *e, size_t *n)
+{
+    unsigned char b;
+    do{
+        if (*s >= e) return false;
+        b = *(*s)++;
+        *n += b;
+    } while (b == 255);
+    return true;
+}
+
+static bool
+lz_unpack(unsigned char *dst, size_t dn, const unsigned char *s, size_t sn)
+{
+    const unsigned char *e = s + sn;
+    unsigned char *d = dst, *de = dst + dn;
+
+    while (s < e){
+        unsigned char t = *s++;
+        size_t nlit = t >> 4, mlen = t & 15;
+        if (nlit == 15 && !lz_getlen(&s, e, &nlit)) return false;
+        if (nlit > (size_t)(e - s) || nlit > (size_t)(de - d)) return false;
+        memcpy(d, s, nlit);
+        d += nlit;
+        s += nlit;
+        if (s == e) break;
+
+        if (e - s < 2) return false;
+        size_t off = s[0] | (size_t)s[1] << 8;
+        s += 2;
+        if (mlen == 15 && !lz_getlen(&s, e, &mlen)) return false;
+        mlen += LZ_MIN;
+        if (!off || off > (size_t)(d - dst) || mlen > (size_t)(de - d)) return false;
+        for (const unsigned char *r = d - off; mlen--; )
+            *d++ = *r++;
+    }
+    return d == de;
+}
+
+/**** SEGMENTS */
+static void
+compress(struct history *h, struct hist_seg *g)
+{
+    /* Keep the compressed form only if it's smaller. */
+    unsigned char *c = malloc(LZ_BOUND(g->len));
+    if (!c) return;
+    size_t n = lz_pack(c, g->data, g->len);
+    unsigned char *t = n < g->len? realloc(c, n? n : 1) : NULL;
+    if (!t){
+        free(c);
+        t = realloc(g->data, g->len? g->len : 1);
+        if (t) g->data = t;
+        g->size = g->len;
+        return;
+    }
+    free(g->data);
+    h->bytes -= g->len;
+    h->bytes += n;
+    g->data = t;
+    g->len = g->size = n;
+    g->packed = true;
+}
+
+static void
+dropspilled(struct history *h)
+{
+    h->count -= HIST_SEG_LINES - h->skip;
+    h->shead = (h->shead + 1) % h->spcap;
+    h->nspill--;
+    h->skip = 0;
+#ifdef TMT_HAS_MMAP
+    if (!h->nspill && ftruncate(h->fd, 0) == 0)
+        h->fsize = 0;
+#endif
+}
+
+static void
+dropsegment(struct history *h)
+{
+    /* Drop the oldest segment in memory, which is the oldest of all
+     * unless some have been spilled.
+     */
+    struct hist_seg *g = SEG(h, 0);
+    h->count -= g->n - (h->nspill? 0 : h->skip);
+    h->bytes -= g->len;
+    free(g->data);
+    g->data = NULL;
+    h->head = (h->head + 1) % h->cap;
+    h->nseg--;
+    if (!h->nspill)
+        h->skip = 0;
+}
+
+static void
+dropoldest(struct history *h)
+{
+    if (h->nspill)
+        dropspilled(h);
+    else
+        dropsegment(h);
+}
+
+#ifdef TMT_HAS_MMAP
+static bool
+writeall(int fd, const void *p, size_t n, uint64_t pos)
+{
+    for (const char *b = p; n; ){
+        ssize_t w = pwrite(fd, b, n, (off_t)pos);
+        if (w <= 0) return false;
+        b += w;
+        n -= (size_t)w;
+        pos += (uint64_t)w;
+    }
+    return true;
+}
+#endif
+
+static bool
+spilloldest(struct history *h)
+{
+#ifdef TMT_HAS_MMAP
+    struct hist_seg *g = SEG(h, 0);
+    if (!g->packed)
+        compress(h, g);
+
+    if (h->nspill == h->spcap){
+        size_t cap = h->spcap? h->spcap * 2 : 64;
+        uint64_t *s = malloc(cap * sizeof(*s));
+        if (!s) return false;
+        for (size_t i = 0; i < h->nspill; i++)
+            s[i] = SPILL(h, i);
+        free(h->spill);
+        h->spill = s;
+        h->shead = 0;
+        h->spcap = cap;
+    }
+
+    struct spill_hdr hd = {g->seq, (uint32_t)g->n, (uint32_t)g->rawlen,
+                           (uint32_t)g->len, g->packed, {0}};
+    memcpy(hd.off, g->off, sizeof(hd.off));
+    uint64_t pad = (8 - g->len % 8) % 8, zero = 0;
+    if (!writeall(h->fd, &hd, sizeof(hd), h->fsize)
+     || !writeall(h->fd, g->data, g->len, h->fsize + sizeof(hd))
+     || !writeall(h->fd, &zero, pad, h->fsize + sizeof(hd) + g->len))
+        return false;
+
+    SPILL(h, h->nspill++) = h->fsize;
+    h->fsize += sizeof(hd) + g->len + pad;
+    h->bytes -= g->len;
+    free(g->data);
+    g->data = NULL;
+    h->head = (h->head + 1) % h->cap;
+    h->nseg--;
+    return true;
+#else
+    (void)h;
+    return false;
+#endif
+}
+
+static void
+trim(struct history *h)
+{
+    /* Lines are dropped one at a time, bytes a segment at a time; the
+     * newest segment is never dropped or spilled for bytes. If the spill
+     * file can't be written, spilling stops; what's in the file stays,
+     * since it takes no memory, and segments in memory are dropped.
+     */
+    while (h->maxlines && h->count > h->maxlines){
+        h->count--;
+        if (++h->skip == (h->nspill? HIST_SEG_LINES : SEG(h, 0)->n))
+            dropoldest(h);
+    }
+    while (h->maxbytes && h->bytes > h->maxbytes && h->nseg > 1){
+        if (h->spilling && !spilloldest(h))
+            h->spilling = false;
+        if (!h->spilling)
+            dropsegment(h);
+    }
+}
+
+static bool
+grow(struct history *h)
+{
+    size_t cap = h->cap? h->cap * 2 : 16;
+    struct hist_seg *s = malloc(cap * sizeof(*s));
+    if (!s) return false;
+    for (size_t i = 0; i < h->nseg; i++)
+        s[i] = *SEG(h, i);
+    free(h->segs);
+    h->segs = s;
+    h->head = 0;
+    h->cap = cap;
+    return true;
+}
+
+void
+history_free(struct history *h)
+{
+    while (h->nseg)
+        dropoldest(h);
+    free(h->segs);
+    free(h->spill);
+    free(h->cache);
+#ifdef TMT_HAS_MMAP
+    if (h->map)
+        munmap(h->map, h->maplen);
+    if (h->fd >= 0)
+        close(h->fd);
+#endif
+    history_init(h);
+}
+
+void
+history_init(struct history *h)
+{
+    memset(h, 0, sizeof(*h));
+    h->fd = -1;
+}
+
+bool
+history_spill(struct history *h, const char *path)
+{
+#ifdef TMT_HAS_MMAP
+    if (h->fd >= 0)
+        return false;
+    if (path)
+        h->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    else{
+        FILE *f = tmpfile();
+        h->fd = f? dup(fileno(f)) : -1;
+        if (f) fclose(f);
+    }
+    if (h->fd < 0)
+        return false;
+    h->spilling = true;
+    trim(h);
+    return true;
+#else
+    (void)h; (void)path;
+    return false;
+#endif
+}
+
+void
+history_limit(struct history *h, size_t maxlines, size_t maxbytes)
+{
+    h->maxlines = maxlines;
+    h->maxbytes = maxbytes;
+    trim(h);
+}
+
+bool
+history_push(struct history *h, const void *data, size_t len)
+{
+    struct hist_seg *g = h->nseg? SEG(h, h->nseg - 1) : NULL;
+
+    if (!g || g->n == HIST_SEG_LINES){
+        if (h->nseg == h->cap && !grow(h))
+            return false;
+        g = SEG(h, h->nseg++);
+        memset(g, 0, sizeof(*g));
+        g->seq = h->nextseq++;
+        if (h->nseg > HOT_SEGS)
+            compress(h, SEG(h, h->nseg - 1 - HOT_SEGS));
+    }
+
+    if (g->len + len > UINT32_MAX)
+        return false;
+    if (g->len + len > g->size){
+        size_t size = g->size? g->size * 2 : 1024;
+        while (size < g->len + len)
+            size *= 2;
+        unsigned char *d = realloc(g->data, size);
+        if (!d) return false;
+        g->data = d;
+        g->size = size;
+    }
+    memcpy(g->data + g->len, data, len);
+    g->len += len;
+    g->rawlen = g->len;
+    g->off[++g->n] = (uint32_t)g->len;
+    h->bytes += len;
+    h->count++;
+    trim(h);
+    return true;
+}
+
+static const unsigned char *
+unpack(struct history *h, size_t seq, const unsigned char *d, size_t len,
+       size_t rawlen)
+{
+    if (!h->cache || h->cacheseq != seq){
+        if (rawlen > h->szcache){
+            unsigned char *c = realloc(h->cache, rawlen);
+            if (!c) return NULL;
+            h->cache = c;
+            h->szcache = rawlen;
+        }
+        h->cacheseq = seq;
+        if (!lz_unpack(h->cache, rawlen, d, len)){
+            h->cacheseq = (size_t)-1;
+            return NULL;
+        }
+    }
+    return h->cache;
+}
+
+#ifdef TMT_HAS_MMAP
+static const struct spill_hdr *
+mapspilled(struct history *h, uint64_t pos)
+{
+    /* Map past the end of the file so appends rarely force a remap;
+     * nothing beyond fsize is ever touched.
+     */
+    if (h->maplen < h->fsize){
+        if (h->map)
+            munmap(h->map, h->maplen);
+        size_t len = (size_t)(h->fsize + h->fsize / 2 + (1 << 20));
+        void *m = mmap(NULL, len, PROT_READ, MAP_SHARED, h->fd, 0);
+        h->map = m == MAP_FAILED? NULL : m;
+        h->maplen = h->map? len : 0;
+        if (!h->map) return NULL;
+    }
+    return (const struct spill_hdr *)(h->map + pos);
+}
+#endif
+
+const unsigned char *
+history_get(struct history *h, size_t n, size_t *len)
+{
+    if (n >= h->count) return NULL;
+    size_t a = h->skip + h->count - 1 - n;
+    size_t i = a / HIST_SEG_LINES, r = a % HIST_SEG_LINES;
+    const uint32_t *off;
+    const unsigned char *d;
+
+    if (i < h->nspill){
+#ifdef TMT_HAS_MMAP
+        const struct spill_hdr *hd = mapspilled(h, SPILL(h, i));
+        if (!hd) return NULL;
+        d = (const unsigned char *)(hd + 1);
+        if (hd->packed && !(d = unpack(h, hd->seq, d, hd->len, hd->rawlen)))
+            return NULL;
+        off = hd->off;
+#else
+        return NULL;
+#endif
+    } else{
+        struct hist_seg *g = SEG(h, i - h->nspill);
+        d = g->data;
+        if (g->packed && !(d = unpack(h, g->seq, d, g->len, g->rawlen)))
+            return NULL;
+        off = g->off;
+    }
+    *len = off[r + 1] - off[r];
+    return d + off[r];
+}
@@ -0,0 +1,71 @@
+#ifndef TMT_HISTORY_H
+#define TMT_HISTORY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* A store of scrollback records: opaque, self-contained byte strings,
+ * one per line, kept newest last and trimmed from the oldest end to stay
+ * within a line count and a byte budget.
+ *
+ * Records are kept in segments of HIST_SEG_LINES. All but the newest
+ * few segments are compressed, and decompressed again one segment at a
+ * time when read.
+ *
+ * With a spill file, segments pushed out by the byte budget are appended
+ * to the file instead of being dropped, and only their file offsets are
+ * kept in memory; the file is mapped and read in place. Spilling needs
+ * TMT_HAS_MMAP.
+ */
+#define HIST_SEG_LINES 64
+
+struct hist_seg{
+    unsigned char *data;  /* the records back to back, maybe compressed */
+    size_t len, size;     /* bytes used and allocated in data          */
+    size_t rawlen;        /* bytes once decompressed                   */
+    size_t n;             /* number of records                         */
+    size_t seq;           /* serial number, for the cache              */
+    bool packed;          /* data is compressed                        */
+    uint32_t off[HIST_SEG_LINES + 1]; /* record offsets in the raw data */
+};
+
+struct history{
+    struct hist_seg *segs; /* ring of segments, oldest at head    */
+    size_t head, nseg, cap;
+    size_t skip;           /* records dropped from the oldest one */
+    size_t count;          /* records held                        */
+    size_t bytes;          /* bytes of segment data held          */
+    size_t maxlines;       /* 0 means no limit                    */
+    size_t maxbytes;       /* 0 means no limit                    */
+    size_t nextseq;
+
+    uint64_t *spill;       /* file offsets of spilled segments,   */
+    size_t shead, nspill, spcap; /* a ring, oldest at shead       */
+    bool spilling;
+    int fd;                /* the spill file, or -1               */
+    uint64_t fsize;        /* bytes written to the file           */
+    unsigned char *map;
+    size_t maplen;
+
+    unsigned char *cache;  /* the last compressed segment read    */
+    size_t szcache, cacheseq;
+};
+
+/* An empty store, with no limits; history_free leaves h this way too. */
+void history_init(struct history *h);
+void history_free(struct history *h);
+void history_limit(struct history *h, size_t maxlines, size_t maxbytes);
+bool history_push(struct history *h, const void *data, size_t len);
+
+/* Spill to the file at path, created or truncated, or to an anonymous
+ * temporary file if path is NULL. Fails if h is already spilling.
+ */
+bool history_spill(struct history *h, const char *path);
+
+/* Record n, counting back from the newest (0); NULL if there is none.
+ * The pointer is good until the next call on h.
+ */
+const unsigned char *history_get(struct history *h, size_t n, size_t *len);
+
+#endif
@@ -0,0 +1,411 @@
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+#include "tmt.h"
+#include "cell.h"
+
+#ifdef FORCE_UTF8
+#include "u8mbtowc.h"
+#else
+#include <wchar.h>
+#endif
+
+#define CSI "\033["
+#define SGR_MAX 8 /* parameters to an SGR sequence; libtmt takes no more */
+#define NUM_MAX (sizeof(size_t) * 3) /* digits in a size_t, and then some */
+
+/* The longest SEQ is a cursor movement with two counts, or an SGR change
+ * of up to seven plain parameters (CSI or ';' and at most two digits
+ * each) and two direct colors (CSI or ';' and 16 characters each), split
+ * into at most three sequences.
+ */
+#define SEQ_MAX MAX(7 + 2 * NUM_MAX, 7 * 4 + 2 * 18 + 3)
+/* Room taken by the character to the left: the pad of a wide one, or the
+ * space held for a wide one joined to a format character. */
+#define FILLER(l, x) ((x) && (((l)[x].char_type == TMT_IGNORED && \
+                      (l)[(x) - 1].char_type == TMT_FULLWIDTH) || \
+                     ((l)[x].char_type == TMT_FULLWIDTH && \
+                      (l)[(x) - 1].char_type == TMT_FORMATTER && (l)[(x) - 1].marks)))
+
+/* A rendering in progress. The host is as it will be once it has read
+ * the output so far; its cursor column is the screen width if the host
+ * went past the last column, and its row the screen height if the host
+ * may have wrapped to who knows where.
+ */
+typedef struct RENDER RENDER;
+struct RENDER{
+    const TMT *vt;
+    const TMTSCREEN *s;
+    TMTHOST h;
+    char *buf;
+    size_t size, len; /* len counts output that didn't fit too */
+};
+
+/* A few short escape sequences under construction. */
+typedef struct SEQ SEQ;
+struct SEQ{
+    char b[SEQ_MAX];
+    size_t n;
+    size_t npar; /* parameters to the SGR sequence left open */
+};
+
+static void
+put(RENDER *o, const char *s, size_t n)
+{
+    if (o->len < o->size)
+        memcpy(o->buf + o->len, s, MIN(n, o->size - o->len));
+    o->len += n;
+}
+
+static void
+add(SEQ *q, const char *s)
+{
+    assert(q->n + strlen(s) <= sizeof(q->b));
+    while (*s && q->n < sizeof(q->b))
+        q->b[q->n++] = *s++;
+}
+
+static size_t
+digits(size_t v)
+{
+    size_t n = 1;
+    while (v >= 10)
+        v /= 10, n++;
+    return n;
+}
+
+static void
+addnum(SEQ *q, size_t v)
+{
+    char t[NUM_MAX + 1];
+    size_t n = digits(v);
+    t[n] = 0;
+    do t[--n] = (char)('0' + v % 10); while (v /= 10);
+    add(q, t);
+}
+
+static size_t
+csilen(size_t v)
+{
+    /* Length of a CSI sequence with count v, left out when it's 1. */
+    return v == 1? 3 : 3 + digits(v);
+}
+
+static void
+csi(SEQ *q, size_t v, const char *f)
+{
+    add(q, CSI);
+    if (v != 1) addnum(q, v);
+    add(q, f);
+}
+
+static void
+moveto(RENDER *o, size_t r, size_t c)
+{
+    /* Take the host's cursor to row r, column c by the shorter of an
+     * absolute move and a relative one. A carriage return gets the
+     * column back once the host has lost it, and a line feed is only
+     * used from column 0, where it lands whether or not the host's tty
+     * adds a carriage return of its own. A lost row takes an absolute one.
+     */
+    TMTPOINT *p = &o->h.curs;
+    SEQ a = {{0}, 0, 0}, b = {{0}, 0, 0};
+    size_t hc = p->c;
+    if (p->r == r && p->c == c) return;
+
+    add(&a, CSI);
+    if (r || c) addnum(&a, r + 1);
+    if (c){
+        add(&a, ";");
+        addnum(&a, c + 1);
+    }
+    add(&a, "H");
+
+    if (p->r < o->s->nline){
+        if (hc >= o->s->ncol || (c < hc && (c == 0 ||
+            1 + csilen(c) < (hc - c < 4? hc - c : csilen(hc - c))))){
+            add(&b, "\r");
+            hc = 0;
+        }
+        if (r > p->r && hc == 0 && r - p->r < 4)
+            for (size_t i = p->r; i < r; i++)
+                add(&b, "\n");
+        else if (r > p->r)
+            csi(&b, r - p->r, "B");
+        else if (r < p->r)
+            csi(&b, p->r - r, "A");
+        if (c > hc)
+            csi(&b, c - hc, "C");
+        else if (c < hc && hc - c < 4)
+            for (size_t i = c; i < hc; i++)
+                add(&b, "\b");
+        else if (c < hc)
+            csi(&b, hc - c, "D");
+    }
+
+    if (b.n && b.n < a.n)
+        put(o, b.b, b.n);
+    else
+        put(o, a.b, a.n);
+    p->r = r;
+    p->c = c;
+}
+
+static void
+param(SEQ *q, const char *p, size_t k)
+{
+    /* Add k parameters to an SGR sequence, starting another when the
+     * host might not take them all in one.
+     */
+    if (q->npar && q->npar + k > SGR_MAX){
+        add(q, "m");
+        q->npar = 0;
+    }
+    add(q, q->npar? ";" : CSI);
+    add(q, p);
+    q->npar += k;
+}
+
+static void
+addcolor(SEQ *q, tmt_color_t c, size_t base)
+{
+    /* base is 30 for the foreground and 40 for the background. */
+    SEQ p = {{0}, 0, 0};
+    if (c.code == TMT_COLOR_RGB){
+        addnum(&p, base + 8);
+        add(&p, ";2;");
+        addnum(&p, c.red);
+        add(&p, ";");
+        addnum(&p, c.green);
+        add(&p, ";");
+        addnum(&p, c.blue);
+    } else if (c.code >= TMT_COLOR_BRIGHT_BLACK)
+        addnum(&p, base + 60 + (size_t)(c.code - TMT_COLOR_BRIGHT_BLACK));
+    else if (c.code >= TMT_COLOR_BLACK)
+        addnum(&p, base + (size_t)(c.code - TMT_COLOR_BLACK));
+    else
+        addnum(&p, base + 9);
+    param(q, p.b, c.code == TMT_COLOR_RGB? 5 : 1);
+}
+
+static void
+addon(SEQ *q, const TMTATTRS *a, const TMTATTRS *h)
+{
+    /* Turn on whatever a has and h hasn't. */
+    if (a->bold && !h->bold) param(q, "1", 1);
+    if (a->dim && !h->dim) param(q, "2", 1);
+    if (a->underline && !h->underline) param(q, "4", 1);
+    if (a->blink && !h->blink) param(q, "5", 1);
+    if (a->reverse && !h->reverse) param(q, "7", 1);
+    if (a->invisible && !h->invisible) param(q, "8", 1);
+    if (!samecolor(a->fg, h->fg)) addcolor(q, a->fg, 30);
+    if (!samecolor(a->bg, h->bg)) addcolor(q, a->bg, 40);
+}
+
+static void
+setattrs(RENDER *o, const TMTATTRS *a)
+{
+    /* Change the host's rendition to a, either by turning off what has
+     * to go and on what's missing, or by resetting it and turning on
+     * everything, whichever is shorter.
+     */
+    TMTATTRS *h = &o->h.attrs;
+    SEQ z = {{0}, 0, 0}, d = {{0}, 0, 0};
+    if (sameattrs(h, a)) return;
+
+    param(&z, "0", 1);
+    addon(&z, a, &defattrs);
+    if (z.n == 3) z.n = 2;
+    add(&z, "m");
+
+    TMTATTRS t = *h;
+    if ((t.bold && !a->bold) || (t.dim && !a->dim)){
+        param(&d, "22", 1);
+        t.bold = t.dim = false;
+    }
+    if (t.underline && !a->underline) param(&d, "24", 1);
+    if (t.blink && !a->blink) param(&d, "25", 1);
+    if (t.reverse && !a->reverse) param(&d, "27", 1);
+    if (t.invisible && !a->invisible) param(&d, "28", 1);
+    addon(&d, a, &t);
+    add(&d, "m");
+
+    if (d.n < z.n)
+        put(o, d.b, d.n);
+    else
+        put(o, z.b, z.n);
+    *h = *a;
+}
+
+static size_t
+encode(char *b, tmt_wchar_t w)
+{
+    /* Into b, which holds MB_LEN_MAX bytes; '?' if w has no encoding
+     * or is a control the host would act on.
+     */
+    if (w < 0x20 || (w >= 0x7f && w < 0xa0)){
+        b[0] = '?';
+        return 1;
+    }
+#ifdef FORCE_UTF8
+    int n = wc_to_utf8(b, MB_LEN_MAX, w);
+    if (n > 0) return (size_t)n;
+#else
+    mbstate_t ms;
+    memset(&ms, 0, sizeof(ms));
+    size_t n = wcrtomb(b, w, &ms);
+    if (n != (size_t)-1) return n;
+#endif
+    b[0] = '?';
+    return 1;
+}
+
+static void
+putcell(RENDER *o, const TMTCHAR *ch)
+{
+    /* Print ch where the host's cursor is. A format character left on
+     * its own takes no room on most terminals, so where the host's cursor
+     * ends up is anyone's guess after one.
+     */
+    char b[MB_LEN_MAX];
+    const tmt_wchar_t *m = NULL;
+    size_t nm = tmt_char_marks(o->vt, ch, &m);
+    setattrs(o, tmt_char_attrs(o->vt, ch));
+    put(o, b, encode(b, ch->char_type == TMT_IGNORED? L' ' : ch->c));
+    for (size_t i = 0; i < nm; i++)
+        put(o, b, encode(b, m[i]));
+    switch (ch->char_type){
+        case TMT_FULLWIDTH: o->h.curs.c += 2;           break;
+        case TMT_FORMATTER: o->h.curs.r = o->s->nline;
+                            o->h.curs.c = o->s->ncol;   break;
+        default:            o->h.curs.c += 1;           break;
+    }
+    o->h.curs.c = MIN(o->h.curs.c, o->s->ncol);
+}
+
+static void
+drawline(RENDER *o, size_t r, size_t a, size_t b, bool clear)
+{
+    /* Bring columns a to b of row r up to date on the host; if clear,
+     * the host's row is blank already. Blanks running to the end of the
+     * line are erased in one go, blanks within it with ECH and runs of
+     * one character with REP when the host has them and they're shorter.
+     */
+    const TMTSCREEN *s = o->s;
+    const TMTCHAR *l = s->lines[r]->chars;
+    size_t t = s->ncol;
+
+    while (FILLER(l, a))
+        a--;
+    if (b + 1 < s->ncol && l[b].char_type == TMT_FULLWIDTH)
+        b++;
+    while (t > a && BLANK(&l[t - 1]))
+        t--;
+
+    for (size_t x = a; x <= b && x < t; ){
+        const TMTCHAR *ch = &l[x];
+        size_t n = 1;
+        if (FILLER(l, x)){
+            x++;
+            continue;
+        }
+
+        if (BLANK(ch)){
+            while (x + n <= b && BLANK(&l[x + n]))
+                n++;
+            if (clear && (n > 3 || !sameattrs(&o->h.attrs, &defattrs))){
+                x += n;
+                continue;
+            }
+            size_t sp = o->h.rep && n > 1? MIN(n, 1 + csilen(n - 1)) : n;
+            if (!clear && o->h.ech && 2 * csilen(n) < sp){
+                SEQ q = {{0}, 0, 0};
+                moveto(o, r, x);
+                setattrs(o, &defattrs);
+                csi(&q, n, "X");
+                put(o, q.b, q.n);
+                x += n;
+                continue;
+            }
+        }
+
+        moveto(o, r, x++);
+        putcell(o, ch);
+
+        if (o->h.rep && ch->char_type == TMT_HALFWIDTH && !ch->marks){
+            char e[MB_LEN_MAX];
+            size_t k = 0;
+            while (x + k <= b && x + k < t && SAMECELL(&l[x + k], ch))
+                k++;
+            if (k && csilen(k) < k * encode(e, ch->c)){
+                SEQ q = {{0}, 0, 0};
+                csi(&q, k, "b");
+                put(o, q.b, q.n);
+                x += k;
+                o->h.curs.c = MIN(o->h.curs.c + k, s->ncol);
+            }
+        }
+    }
+
+    if (t <= b && !clear){
+        moveto(o, r, t);
+        setattrs(o, &defattrs);
+        if (b - t + 1 > 3)
+            put(o, CSI "K", 3);
+        else for (size_t x = t; x <= b; x++)
+            putcell(o, &l[x]);
+    }
+}
+
+size_t
+tmt_render_shift(const TMT *vt, TMTHOST *h, const TMTSHIFT *sh, char *buf,
+                 size_t size)
+{
+    /* Move the host's rows the way sh says by scrolling just those: set
+     * the scrolling region, scroll it and set it back, which also homes
+     * the cursor. The rows this uncovers are dirty already.
+     */
+    RENDER o = {vt, tmt_screen(vt), *h, buf, size, 0};
+    SEQ q = {{0}, 0, 0};
+    if (!o.h.known || !sh->n) return 0;
+
+    add(&q, CSI);
+    addnum(&q, sh->top + 1);
+    add(&q, ";");
+    addnum(&q, sh->bottom);
+    add(&q, "r");
+    put(&o, q.b, q.n);
+    q.n = 0;
+    csi(&q, (size_t)(sh->n > 0? sh->n : -sh->n), sh->n > 0? "S" : "T");
+    put(&o, q.b, q.n);
+    put(&o, CSI "r", 3);
+    o.h.curs.r = o.h.curs.c = 0;
+    if (o.len <= size)
+        *h = o.h;
+    return o.len;
+}
+
+size_t
+tmt_render(const TMT *vt, TMTHOST *h, char *buf, size_t size)
+{
+    RENDER o = {vt, tmt_screen(vt), *h, buf, size, 0};
+    const TMTSCREEN *s = o.s;
+    const TMTPOINT *c = tmt_cursor(vt);
+
+    if (!o.h.known){
+        static const char clear[] = CSI "m" CSI "H" CSI "2J";
+        put(&o, clear, sizeof(clear) - 1);
+        o.h.known = true;
+        o.h.curs.r = o.h.curs.c = 0;
+        o.h.attrs = defattrs;
+        for (size_t r = 0; r < s->nline; r++)
+            drawline(&o, r, 0, s->ncol - 1, true);
+    } else for (size_t r = tmt_next_dirty(vt, 0); r < s->nline;
+                r = tmt_next_dirty(vt, r + 1))
+        drawline(&o, r, s->lines[r]->dmin, s->lines[r]->dmax, false);
+
+    moveto(&o, MIN(c->r, s->nline - 1), MIN(c->c, s->ncol - 1));
+    if (o.len <= size)
+        *h = o.h;
+    return o.len;
+}
@@ -0,0 +1,263 @@
+/* Dirty tracking: which rows and columns tmt_write reports as changed.
+ *
+ *     cc -I. -o t tests/dirty.c *.c && ./t
+ */
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../cell.h"
+
+#define ROWS 10
+#define COLS 20
+
+static size_t
+ndirty(const TMT *vt)
+{
+    size_t n = 0, nl = tmt_screen(vt)->nline;
+    for (size_t r = tmt_next_dirty(vt, 0); r < nl; r = tmt_next_dirty(vt, r + 1))
+        n++;
+    return n;
+}
+
+static void
+scribble(TMT *vt)
+{
+    /* A few random writes, moves, erasures, scrolls and screen switches. */
+    static const char *seqs[] ={
+        "hello", "x", "xx", "\033[1mbold\033[m", "\r\n", "\033[%u;%uH",
+        "\033[%uK", "\033[%uJ", "\033[%u@", "\033[%uP", "\033[%uL",
+        "\033[%uM", "\033[%uX", "\033[%uS", "\033[%uT", "\033[%u;%ur",
+        "\033[r", "\033[?1049h", "\033[?1049l", "\033[%ub", "\033M"
+    };
+    char b[32];
+    for (unsigned n = 1 + rnd(4); n; n--){
+        snprintf(b, sizeof(b), seqs[rnd(sizeof(seqs) / sizeof(seqs[0]))],
+                 rnd(ROWS + 1), rnd(ROWS + 1));
+        tmt_write(vt, b, 0);
+    }
+}
+
+static TMTCHAR before[ROWS][COLS];
+
+static void
+snapshot(const TMT *vt)
+{
+    const TMTSCREEN *s = tmt_screen(vt);
+    for (size_t r = 0; r < ROWS; r++)
+        memcpy(before[r], s->lines[r]->chars, sizeof(before[r]));
+}
+
+static bool
+covered(const TMT *vt, size_t *row)
+{
+    /* Every cell that changed since the snapshot is in its row's dirty
+     * range.
+     */
+    const TMTSCREEN *s = tmt_screen(vt);
+    for (size_t r = 0; r < ROWS; r++){
+        const TMTLINE *l = s->lines[r];
+        for (size_t c = 0; c < COLS; c++)
+            if (!SAMECELL(&l->chars[c], &before[r][c]) &&
+                (!l->dirty || c < l->dmin || c > l->dmax)){
+                *row = r;
+                return false;
+            }
+    }
+    return true;
+}
+
+static void
+bitmap(void)
+{
+    /* tmt_next_dirty() visits exactly the rows flagged dirty, and those
+     * cover every change.
+     */
+    TMT *vt = tmt_open(ROWS, COLS, NULL, NULL, NULL);
+    size_t bad = 0;
+    CHECK(vt);
+    if (!vt) return;
+    snapshot(vt);
+    for (int i = 0; i < 5000 && bad < 3; i++){
+        size_t r = 0, n = 0, row;
+        scribble(vt);
+        for (size_t d = tmt_next_dirty(vt, 0); d < ROWS; d = tmt_next_dirty(vt, d + 1)){
+            const TMTLINE *l = tmt_screen(vt)->lines[d];
+            for (; r < d; r++)
+                if (tmt_screen(vt)->lines[r]->dirty) n++;
+            if (!l->dirty || l->dmin > l->dmax || l->dmax >= COLS) n++;
+            r = d + 1;
+        }
+        for (; r < ROWS; r++)
+            if (tmt_screen(vt)->lines[r]->dirty) n++;
+        if (n){
+            fprintf(stderr, "step %d: bitmap and flags disagree\n", i);
+            bad++;
+        }
+        if (!covered(vt, &row)){
+            fprintf(stderr, "step %d: row %zu changed outside its damage\n", i, row);
+            bad++;
+        }
+        if (rnd(4)){
+            tmt_clean(vt);
+            snapshot(vt);
+        }
+    }
+    CHECK(!bad);
+    tmt_close(vt);
+}
+
+static void
+shifted(tmt_msg_t m, TMT *vt, const void *a, void *p)
+{
+    /* Move the snapshot's rows the way the program would move its own.
+     * Rows left behind hold something no cell ever does, so they count
+     * as changed all the way across.
+     */
+    const TMTSHIFT *sh = a;
+    TMTCHAR t[ROWS][COLS];
+    size_t k = sh->bottom - sh->top;
+    (void)vt;
+    (void)p;
+    if (m != TMT_MSG_SHIFT) return;
+    memcpy(t, before, sizeof(t));
+    for (size_t r = sh->top; r < sh->bottom; r++){
+        size_t f = r - sh->top + (size_t)(sh->n > 0? sh->n : (ptrdiff_t)k + sh->n);
+        if (sh->n > 0? f < k : f >= k)
+            memcpy(before[r], t[sh->top + f % k], sizeof(before[r]));
+        else for (size_t c = 0; c < COLS; c++)
+            before[r][c].c = 1;
+    }
+}
+
+static void
+shifts(void)
+{
+    /* With shifts reported, the rows that merely moved aren't dirty, but
+     * every change on top of the moves is.
+     */
+    TMT *vt = tmt_open(ROWS, COLS, shifted, NULL, NULL);
+    size_t bad = 0, row;
+    CHECK(vt);
+    if (!vt) return;
+    tmt_report_shifts(vt, true);
+    tmt_clean(vt);
+    snapshot(vt);
+    for (int i = 0; i < 5000 && bad < 3; i++){
+        scribble(vt);
+        if (!covered(vt, &row)){
+            fprintf(stderr, "step %d: row %zu changed outside its damage\n", i, row);
+            bad++;
+        }
+        if (rnd(4)){
+            tmt_clean(vt);
+            snapshot(vt);
+        }
+    }
+    CHECK(!bad);
+    tmt_close(vt);
+}
+
+struct watcher{
+    TMTCHAR rows[ROWS][COLS];
+    uint64_t gen;
+};
+
+static bool
+catchup(const TMT *vt, struct watcher *w)
+{
+    /* Every row that changed since w last looked has a newer generation,
+     * and none has one newer than the screen's; then look again.
+     */
+    const TMTSCREEN *s = tmt_screen(vt);
+    uint64_t g = tmt_generation(vt);
+    bool ok = g >= w->gen;
+    for (size_t r = 0; r < ROWS; r++){
+        uint64_t lg = tmt_line_generation(vt, r);
+        for (size_t c = 0; c < COLS; c++)
+            if (!SAMECELL(&s->lines[r]->chars[c], &w->rows[r][c]) && lg <= w->gen)
+                ok = false;
+        if (lg > g)
+            ok = false;
+        memcpy(w->rows[r], s->lines[r]->chars, sizeof(w->rows[r]));
+    }
+    w->gen = g;
+    return ok;
+}
+
+static void
+generations(void)
+{
+    /* Two programs watch one screen, one after every write and one now
+     * and then, and a third cleans it now and then, which they don't see.
+     */
+    TMT *vt = tmt_open(ROWS, COLS, NULL, NULL, NULL);
+    static struct watcher fast, slow;
+    size_t bad = 0;
+    CHECK(vt);
+    if (!vt) return;
+    catchup(vt, &fast);
+    catchup(vt, &slow);
+    for (int i = 0; i < 5000 && bad < 3; i++){
+        scribble(vt);
+        if (!catchup(vt, &fast) || (!rnd(8) && !catchup(vt, &slow))){
+            fprintf(stderr, "step %d: a change kept an old generation\n", i);
+            bad++;
+        }
+        if (!rnd(3))
+            tmt_clean(vt);
+    }
+    CHECK(!bad);
+    tmt_close(vt);
+}
+
+static void
+paint(TMT *vt, const char *clear, int frame)
+{
+    /* A dashboard that erases the screen and redraws all of it, with
+     * one number that changes from frame to frame.
+     */
+    char b[64];
+    tmt_write(vt, clear, 0);
+    for (int r = 0; r < 10; r++){
+        snprintf(b, sizeof(b), "\033[%d;1Hrow %d: %s", r + 1, r,
+                 r == 4? (frame? "up" : "down") : "steady");
+        tmt_write(vt, b, 0);
+    }
+}
+
+static void
+repaint(const char *setup, const char *clear)
+{
+    TMT *vt = tmt_open(10, 20, NULL, NULL, NULL);
+    CHECK(vt);
+    if (!vt) return;
+    tmt_write(vt, setup, 0);
+    paint(vt, clear, 0);
+    tmt_clean(vt);
+
+    /* Drawing the same frame again changes nothing. */
+    paint(vt, clear, 0);
+    CHECK(ndirty(vt) == 0);
+    CHECK(!tmt_screen(vt)->lines[0]->dirty);
+
+    /* A new frame only changes the row that differs, from the first
+     * cell that does.
+     */
+    paint(vt, clear, 1);
+    CHECK(ndirty(vt) == 1);
+    CHECK(tmt_next_dirty(vt, 0) == 4);
+    CHECK(tmt_screen(vt)->lines[4]->dmin == 7);
+    tmt_close(vt);
+}
+
+int
+main(void)
+{
+    repaint("", "\033[H\033[J");
+    repaint("", "\033[2J");
+    repaint("\033[?1049h", "\033[2J");
+    bitmap();
+    generations();
+    shifts();
+    return DONE();
+}
@@ -0,0 +1,154 @@
+/* Scrollback history: lines come back as written through compression,
+ * trimming and, with TMT_HAS_MMAP, spilling to a file.
+ *
+ *     cc -I. -o t tests/history.c *.c && ./t
+ *     cc -DTMT_HAS_MMAP -I. -o t tests/history.c *.c && ./t
+ */
+#ifdef TMT_HAS_MMAP
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include <string.h>
+#include "test.h"
+
+#define ROWS 4
+
+static TMT *
+opened(size_t maxlines, size_t maxbytes)
+{
+    TMT *vt = tmt_open(ROWS, 40, NULL, NULL, NULL);
+    tmt_history_limit(vt, maxlines, maxbytes);
+    return vt;
+}
+
+static void
+fill(TMT *vt, size_t n)
+{
+    /* Have lines 0 to n - 1 scroll through vt. */
+    char b[64];
+    for (size_t i = 0; i < n; i++){
+        snprintf(b, sizeof(b), "\033[%dmline %zu%s\r\n", (int)(31 + i % 7), i,
+                 i % 3? " xxxxxxxxxxxxxxxx" : "");
+        tmt_write(vt, b, 0);
+    }
+}
+
+static bool
+holds(TMT *vt, size_t n, size_t first)
+{
+    /* History holds lines first to n - ROWS, newest last, in colour. */
+    char b[64];
+    size_t w = 0, count = n - (ROWS - 1) - first;
+    if (tmt_history_size(vt) != count)
+        return false;
+    for (size_t k = 0; k < count; k++){
+        size_t i = n - ROWS - k;
+        const TMTCHAR *c = tmt_history_line(vt, k, &w);
+        snprintf(b, sizeof(b), "line %zu%s", i, i % 3? " xxxxxxxxxxxxxxxx" : "");
+        if (!c || strcmp(text(c, w), b) != 0 ||
+            tmt_char_attrs(vt, c)->fg.code != TMT_COLOR_RED + (int)(i % 7))
+            return false;
+    }
+    return !tmt_history_line(vt, count, &w);
+}
+
+static void
+roundtrip(void)
+{
+    TMT *vt = opened(100000, 0);
+    fill(vt, 2000);
+    CHECK(holds(vt, 2000, 0));
+    tmt_close(vt);
+
+    vt = opened(500, 0);
+    fill(vt, 2000);
+    CHECK(holds(vt, 2000, 2000 - (ROWS - 1) - 500));
+    tmt_history_limit(vt, 0, 0);
+    CHECK(tmt_history_size(vt) == 0);
+    tmt_close(vt);
+}
+
+#ifdef TMT_HAS_MMAP
+static void
+spill(void)
+{
+    /* A small budget spills nearly everything, and nothing is lost. */
+    TMT *vt = opened(0, 4096);
+    CHECK(tmt_history_spill(vt, NULL));
+    fill(vt, 5000);
+    CHECK(holds(vt, 5000, 0));
+    CHECK(!tmt_history_spill(vt, NULL));
+    tmt_close(vt);
+
+    /* Descriptor 0 is as good as any. */
+    char path[] = "/tmp/tmtXXXXXX";
+    int fd = mkstemp(path), in = dup(0);
+    CHECK(fd >= 0 && in >= 0);
+    close(fd);
+    close(0);
+    vt = opened(0, 4096);
+    CHECK(tmt_history_spill(vt, path));
+    fill(vt, 1000);
+    CHECK(holds(vt, 1000, 0));
+    tmt_close(vt);
+    CHECK(open(path, O_RDONLY) == 0);
+    close(0);
+    dup2(in, 0);
+    close(in);
+    unlink(path);
+}
+
+static void
+spillfails(void)
+{
+    /* Once the file can't grow, what it holds stays; newer history is
+     * kept within the budget in memory.
+     */
+    struct rlimit old, rl;
+    char b[64];
+    TMT *vt = opened(0, 4096);
+    CHECK(tmt_history_spill(vt, NULL));
+    fill(vt, 3000);
+    size_t before = tmt_history_size(vt), w;
+
+    signal(SIGXFSZ, SIG_IGN);
+    getrlimit(RLIMIT_FSIZE, &old);
+    rl = old;
+    rl.rlim_cur = 0;
+    if (setrlimit(RLIMIT_FSIZE, &rl) != 0)
+        return tmt_close(vt);
+    for (size_t i = 0; i < 3000; i++){
+        snprintf(b, sizeof(b), "later %zu\r\n", i);
+        tmt_write(vt, b, 0);
+    }
+    setrlimit(RLIMIT_FSIZE, &old);
+
+    size_t n = tmt_history_size(vt);
+    CHECK(n > before - 100 && n < before + 3000);
+    const TMTCHAR *c = tmt_history_line(vt, n - 1, &w);
+    CHECK(c && strcmp(text(c, w), "line 0") == 0);
+    c = tmt_history_line(vt, 0, &w);
+    CHECK(c && strcmp(text(c, w), "later 2996") == 0);
+    tmt_close(vt);
+}
+#endif
+
+int
+main(void)
+{
+    roundtrip();
+#ifdef TMT_HAS_MMAP
+    spill();
+    spillfails();
+#else
+    TMT *vt = tmt_open(ROWS, 40, NULL, NULL, NULL);
+    CHECK(!tmt_history_spill(vt, NULL));
+    tmt_close(vt);
+#endif
+    return DONE();
+}
@@ -0,0 +1,116 @@
+/* Reflow on resize, and history rewrapped to match.
+ *
+ *     cc -I. -o t tests/reflow.c *.c && ./t
+ */
+#include <string.h>
+#include "test.h"
+
+static const char *
+histrow(TMT *vt, size_t n)
+{
+    size_t w = 0;
+    const TMTCHAR *c = tmt_history_row(vt, n, &w);
+    return c? text(c, w) : "(none)";
+}
+
+static void
+roundtrip(void)
+{
+    /* A long line wrapped at 10 columns joins up at 25 and wraps the
+     * same way again at 10.
+     */
+    TMT *vt = tmt_open(4, 10, NULL, NULL, NULL);
+    tmt_write(vt, "0123456789abcdefghijKLM", 0);
+    CHECK(strcmp(rowtext(vt, 0), "0123456789") == 0);
+    CHECK(strcmp(rowtext(vt, 2), "KLM") == 0);
+
+    CHECK(tmt_resize(vt, 4, 25));
+    CHECK(strcmp(rowtext(vt, 0), "0123456789abcdefghijKLM") == 0);
+    CHECK(tmt_cursor(vt)->r == 0 && tmt_cursor(vt)->c == 23);
+
+    CHECK(tmt_resize(vt, 4, 10));
+    CHECK(strcmp(rowtext(vt, 0), "0123456789") == 0);
+    CHECK(strcmp(rowtext(vt, 1), "abcdefghij") == 0);
+    CHECK(strcmp(rowtext(vt, 2), "KLM") == 0);
+    CHECK(tmt_cursor(vt)->r == 2 && tmt_cursor(vt)->c == 3);
+    tmt_close(vt);
+}
+
+static void
+historyrows(void)
+{
+    /* Reflowing the screen mustn't disturb history rows read before. */
+    TMT *vt = tmt_open(5, 20, NULL, NULL, NULL);
+    tmt_history_limit(vt, 100, 0);
+    tmt_write(vt, "aaaa\r\nbbbb\r\ncccc\r\ndddd\r\neeee\r\nffff\r\n"
+                  "gggg\r\nhhhh\r\niiii\r\njjjj\r\n", 0);
+    CHECK(strcmp(histrow(vt, 0), "ffff") == 0);
+    CHECK(strcmp(histrow(vt, 3), "cccc") == 0);
+
+    tmt_write(vt, "\033[H\033[Jxyz", 0);
+    CHECK(tmt_resize(vt, 5, 30));
+    CHECK(tmt_resize(vt, 5, 20));
+    CHECK(strcmp(histrow(vt, 3), "cccc") == 0);
+    CHECK(strcmp(histrow(vt, 5), "aaaa") == 0);
+    CHECK(strcmp(histrow(vt, 6), "(none)") == 0);
+    CHECK(strcmp(rowtext(vt, 0), "xyz") == 0);
+    tmt_close(vt);
+}
+
+static void
+scrollback(TMT *vt, int from, int to)
+{
+    /* Numbered lines, some long enough to wrap once or twice. */
+    char b[64];
+    for (int i = from; i < to; i++){
+        snprintf(b, sizeof(b), "line %d%s\r\n", i,
+                 i % 7 == 0? "-wraps-once" : i % 11 == 0? "-wraps-twice-over-here" : "");
+        tmt_write(vt, b, 0);
+    }
+}
+
+static void
+pushes(void)
+{
+    /* Rows read from a viewer that stays open are the same rows after
+     * more lines scroll off, just further back, even as the oldest ones
+     * are trimmed and the newest line runs on into the next.
+     */
+    static char seen[400][32];
+    TMT *vt = tmt_open(5, 20, NULL, NULL, NULL);
+    size_t n, bad = 0;
+    tmt_history_limit(vt, 300, 0);
+    scrollback(vt, 0, 200);
+    snprintf(seen[0], sizeof(seen[0]), "%s", histrow(vt, 150));
+    CHECK(strncmp(seen[0], "line ", 5) == 0);
+    scrollback(vt, 200, 203);
+    CHECK(strcmp(histrow(vt, 153), seen[0]) == 0);
+
+    for (int i = 0; i < 40 && bad < 3; i++){
+        scrollback(vt, 203 + 10 * i, 203 + 10 * i + (int)rnd(10));
+        tmt_write(vt, "abcdefghijklmnopqrstuvwxy", 0);
+        for (n = 0; n < 400 && tmt_history_row(vt, n, &(size_t){0}); n++)
+            snprintf(seen[n], sizeof(seen[n]), "%s", histrow(vt, n));
+
+        /* The same limits again only start the map over. */
+        tmt_history_limit(vt, 300, 0);
+        for (size_t r = 0; r < n; r++)
+            if (strcmp(histrow(vt, r), seen[r]) && bad++ < 3)
+                fprintf(stderr, "round %d: row %zu was %s, is %s\n", i, r,
+                        seen[r], histrow(vt, r));
+        if (strcmp(histrow(vt, n), "(none)") && bad++ < 3)
+            fprintf(stderr, "round %d: more than %zu rows\n", i, n);
+        histrow(vt, rnd(300));
+    }
+    CHECK(!bad);
+    tmt_close(vt);
+}
+
+int
+main(void)
+{
+    roundtrip();
+    historyrows();
+    pushes();
+    return DONE();
+}
@@ -0,0 +1,158 @@
+/* tmt_render and tmt_render_shift: a second terminal fed the output ends
+ * up showing the same cells as the first.
+ *
+ *     cc -I. -o t tests/render.c *.c && ./t
+ *     cc -std=c11 -DFORCE_UTF8 -I. -o t tests/render.c *.c && ./t
+ */
+#include <locale.h>
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../cell.h"
+
+#define ROWS 12
+#define COLS 30
+
+static bool utf8;
+
+static void
+scribble(TMT *vt)
+{
+    /* Write a few random pieces of text, movement, erasure, scrolling
+     * and rendition changes.
+     */
+    static const char *words[] ={"hello", "x", "  ", "tmt", "aaaaaaaa", "=="};
+    static const char *wide[] ={"\xe4\xb8\xad", "\xed\x95\x9c", "e\xcc\x81",
+                                "\xc3\xa9"};
+    static const char *seqs[] ={
+        "\033[%u;%uH", "\033[%uA", "\033[%uC", "\033[%uK", "\033[%uJ",
+        "\033[%u@", "\033[%uP", "\033[%uL", "\033[%uM", "\033[%uX",
+        "\033[%uS", "\033[%uT", "\033[%u;%ur", "\033[r", "\033[%um",
+        "\033[%u;%um", "\033[38;2;%u;%u;9m", "\033[m", "\r\n", "\033[%ub"
+    };
+    static const unsigned sgr[] ={0, 1, 2, 4, 5, 7, 8, 22, 24, 27, 31, 39,
+                                  42, 49, 93, 104};
+    char b[64];
+    for (unsigned n = 1 + rnd(6); n; n--){
+        unsigned k = rnd(10);
+        if (k < 3)
+            tmt_write(vt, words[rnd(sizeof(words) / sizeof(words[0]))], 0);
+        else if (k < 4 && utf8)
+            tmt_write(vt, wide[rnd(sizeof(wide) / sizeof(wide[0]))], 0);
+        else{
+            const char *f = seqs[rnd(sizeof(seqs) / sizeof(seqs[0]))];
+            unsigned x = rnd(ROWS + 1), y = rnd(COLS + 1);
+            if (f[strlen(f) - 1] == 'm'){
+                x = sgr[rnd(sizeof(sgr) / sizeof(sgr[0]))];
+                y = sgr[rnd(sizeof(sgr) / sizeof(sgr[0]))];
+            }
+            snprintf(b, sizeof(b), f, x, y);
+            tmt_write(vt, b, 0);
+        }
+    }
+}
+
+static bool
+samecell(const TMT *va, const TMTCHAR *a, const TMT *vb, const TMTCHAR *b,
+         bool apad, bool bpad)
+{
+    /* The pad of a wide character that was partly overwritten is just
+     * a space to the host.
+     */
+    int ta = a->char_type == TMT_IGNORED && !apad? TMT_HALFWIDTH : a->char_type;
+    int tb = b->char_type == TMT_IGNORED && !bpad? TMT_HALFWIDTH : b->char_type;
+    tmt_wchar_t ca = ta == TMT_HALFWIDTH && a->char_type == TMT_IGNORED? L' ' : a->c;
+    tmt_wchar_t cb = tb == TMT_HALFWIDTH && b->char_type == TMT_IGNORED? L' ' : b->c;
+    const tmt_wchar_t *ma, *mb;
+    size_t na = tmt_char_marks(va, a, &ma), nb = tmt_char_marks(vb, b, &mb);
+
+    if (ta != tb) return false;
+    if (ta == TMT_IGNORED) return true;
+    return ca == cb && na == nb && (!na || !memcmp(ma, mb, na * sizeof(*ma))) &&
+           sameattrs(tmt_char_attrs(va, a), tmt_char_attrs(vb, b));
+}
+
+static bool
+same(const TMT *a, const TMT *b)
+{
+    const TMTSCREEN *s = tmt_screen(a), *t = tmt_screen(b);
+    for (size_t r = 0; r < s->nline; r++)
+        for (size_t c = 0; c < s->ncol; c++){
+            const TMTCHAR *x = s->lines[r]->chars, *y = t->lines[r]->chars;
+            if (!samecell(a, &x[c], b, &y[c],
+                          c && x[c - 1].char_type == TMT_FULLWIDTH,
+                          c && y[c - 1].char_type == TMT_FULLWIDTH)){
+                fprintf(stderr, "row %zu column %zu differs\n", r, c);
+                return false;
+            }
+        }
+    const TMTPOINT *p = tmt_cursor(a), *q = tmt_cursor(b);
+    return MIN(p->r, ROWS - 1) == q->r && MIN(p->c, COLS - 1) == q->c;
+}
+
+static TMTHOST h;
+static char buf[1 << 16];
+static size_t nbuf;
+
+static void
+callback(tmt_msg_t m, TMT *vt, const void *a, void *p)
+{
+    /* Rows that move are moved on the host right away. */
+    (void)p;
+    if (m == TMT_MSG_SHIFT)
+        nbuf += tmt_render_shift(vt, &h, a, buf + nbuf, sizeof(buf) - nbuf);
+}
+
+static void
+roundtrip(bool ech, bool rep, bool shifts)
+{
+    TMT *src = tmt_open(ROWS, COLS, callback, NULL, NULL);
+    TMT *host = tmt_open(ROWS, COLS, NULL, NULL, NULL);
+    size_t bad = 0;
+
+    CHECK(src && host);
+    if (!src || !host) return;
+    memset(&h, 0, sizeof(h));
+    h.ech = ech;
+    h.rep = rep;
+    tmt_report_shifts(src, shifts);
+    for (int i = 0; i < 2000; i++){
+        nbuf = 0;
+        scribble(src);
+        CHECK(nbuf <= sizeof(buf));
+
+        /* Output that doesn't fit leaves h as it was. */
+        TMTHOST o = h;
+        size_t n = tmt_render(src, &h, buf + nbuf, 8);
+        if (n > 8){
+            CHECK(!memcmp(&o, &h, sizeof(h)));
+            n = tmt_render(src, &h, buf + nbuf, sizeof(buf) - nbuf);
+            CHECK(nbuf + n <= sizeof(buf));
+        }
+
+        if (nbuf + n)
+            tmt_write(host, buf, nbuf + n);
+        tmt_clean(src);
+        if (!same(src, host) && bad++ < 3)
+            CHECK(!"host matches");
+        if (i % 500 == 499)
+            h.known = false;
+    }
+    tmt_close(src);
+    tmt_close(host);
+}
+
+int
+main(void)
+{
+#ifdef FORCE_UTF8
+    utf8 = true;
+#else
+    utf8 = setlocale(LC_CTYPE, "C.UTF-8") || setlocale(LC_CTYPE, "en_US.UTF-8");
+#endif
+    roundtrip(false, false, false);
+    roundtrip(true, true, false);
+    roundtrip(false, false, true);
+    roundtrip(true, true, true);
+    return DONE();
+}
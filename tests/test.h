@@ -0,0 +1,54 @@
+#ifndef TMT_TEST_H
+#define TMT_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../tmt.h"
+
+/* Just enough to run checks and report the ones that fail. */
+static int failures;
+
+#define CHECK(x) do{ \
+    if (!(x)){ \
+        fprintf(stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #x); \
+        failures++; \
+    } \
+}while (0)
+
+#define DONE() (failures? EXIT_FAILURE : EXIT_SUCCESS)
+
+/* The helpers are inline so a test that doesn't use one isn't warned
+ * about it.
+ */
+
+/* The same pseudo-random numbers every run, so failures repeat. */
+static inline unsigned
+rnd(unsigned n)
+{
+    static unsigned long seed = 1;
+    seed = seed * 1103515245 + 12345;
+    return (unsigned)(seed >> 16) % n;
+}
+
+static inline const char *
+text(const TMTCHAR *c, size_t n)
+{
+    /* The ASCII text of n cells, trailing blanks trimmed. */
+    static char b[1024];
+    size_t i;
+    for (i = 0; i < n && i < sizeof(b) - 1; i++)
+        b[i] = c[i].c > 0 && c[i].c < 0x7f? (char)c[i].c : '?';
+    while (i && b[i - 1] == ' ')
+        i--;
+    b[i] = 0;
+    return b;
+}
+
+static inline const char *
+rowtext(const TMT *vt, size_t r)
+{
+    const TMTSCREEN *s = tmt_screen(vt);
+    return text(s->lines[r]->chars, s->ncol);
+}
+
+#endif
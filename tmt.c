@@ -31,13 +31,22 @@
 #include <string.h>
 #include "tmt.h"
 #include "wide_lookup.h"
+#include "byte_scan.h"
+#include "history.h"
+#include "cell.h"
 
 #define BUF_MAX 100
 #define PAR_MAX 8
 #define TAB 8
-#define MAX(x, y) (((size_t)(x) > (size_t)(y)) ? (size_t)(x) : (size_t)(y))
-#define MIN(x, y) (((size_t)(x) < (size_t)(y)) ? (size_t)(x) : (size_t)(y))
-#define CLINE(vt) (vt)->screen.lines[MIN((vt)->curs.r, (vt)->screen.nline - 1)]
+#define MARKS_MAX ((size_t)USHRT_MAX + 1)
+#define MARKS_HASH 1024
+#define MARKS_SWEEP 256
+#define STYLES_MAX ((size_t)USHRT_MAX + 1)
+#define STYLES_HASH 4096
+#define STYLES_SWEEP 256
+#define SCROLL_MAX 1024
+#define CROW(vt) MIN((vt)->curs.r, (vt)->screen.nline - 1)
+#define CLINE(vt) (vt)->screen.lines[CROW(vt)]
 
 #define P0(x) (vt->pars[x])
 #define P1(x) (vt->pars[x]? vt->pars[x] : 1)
@@ -56,15 +65,78 @@
 #include "u8mbtowc.h"
 #endif
 
+typedef struct MARKS MARKS;
+struct MARKS{
+    size_t off;          /* first mark in vt->markbuf            */
+    unsigned short n;    /* number of marks                      */
+    unsigned short next; /* next entry in this hash chain, or 0  */
+};
+
+typedef struct SHOWN SHOWN;
+struct SHOWN{
+    TMTCHAR *chars; /* what the program has on a dirty row */
+    bool known;     /* false if that's anyone's guess       */
+};
+
+typedef struct HROW HROW;
+struct HROW{
+    size_t rec; /* newest record of the logical line, by vt->hpushed */
+    size_t row; /* which of its rows, counting from the top */
+};
+
+typedef struct STYLE STYLE;
+struct STYLE{
+    TMTATTRS a;
+    unsigned short next; /* next entry in this hash chain, or 0 */
+};
+
 struct TMT{
     TMTPOINT curs, oldcurs;
     TMTATTRS attrs, oldattrs;
+    unsigned short style;
 
-    bool dirty, acs, ignored;
+    bool dirty, alldirty, acs, ignored, shifts, alt;
     TMTSCREEN screen;
+    TMTLINE **ring;
+    size_t top;
+    uint64_t *dmap;     /* a bit per ring slot, set if its line is dirty */
+    uint64_t gen;       /* generation of the latest change to the screen */
+    uint64_t scrollgen; /* when the whole screen last scrolled          */
+    SHOWN *shown;       /* what the program has on each row             */
+    TMTCHAR *shownbuf;
+    size_t mtop, mbot;  /* scrolling region: rows mtop to mbot - 1 */
+    TMTLINE **altring;  /* the screen not showing, laid out like ring */
+    size_t alttop;
     TMTLINE *tabs;
 
 	TMTSCREEN scroll;
+    size_t szscroll;
+
+    MARKS *marks;
+    size_t nmarks, szmarks, msweep;
+    tmt_wchar_t *markbuf;
+    size_t nmarkbuf, szmarkbuf;
+    unsigned short markhash[MARKS_HASH];
+
+    STYLE *styles;
+    size_t nstyles, szstyles, ssweep;
+    unsigned short stylehash[STYLES_HASH];
+
+    struct history hist;
+    unsigned char *hbuf;
+    size_t szhbuf;
+    unsigned short *hmap;
+    size_t szhmap;
+    TMTCHAR *hline;
+    size_t szhline;
+    TMTCHAR *hlog;      /* one logical line, being rewrapped        */
+    size_t szhlog;
+    size_t *hbrk;       /* where each of its rows starts            */
+    size_t szhbrk;
+    HROW *hrows;        /* rows of history at width hwidth, oldest  */
+    size_t hfirst, nhrows, szhrows, hwidth, hlogrec;
+    size_t hpushed;     /* records ever pushed                      */
+    size_t hfront, hend; /* records [hend, hfront) are in hrows      */
 
     TMTCALLBACK cb;
     void *p;
@@ -75,8 +147,6 @@ struct TMT{
 #else
     mbstate_t ms;
 #endif
-    size_t nmb;
-    char mb[BUF_MAX + 1];
 
 	size_t cursty;
     size_t pars[PAR_MAX];   
@@ -85,8 +155,11 @@ struct TMT{
     enum {S_NUL, S_ESC, S_ARG, S_OS, S_SPA} state;
 };
 
-static TMTATTRS defattrs = {.fg = TMT_COLOR_DEFAULT, .bg = TMT_COLOR_DEFAULT};
 static void writecharatcurs(TMT *vt, tmt_wchar_t w);
+static void setstyle(TMT *vt);
+static bool reflow(TMT *vt, size_t onl, size_t pc, size_t nline, size_t ncol,
+                   bool curs);
+static void pushhistory(TMT *vt, const TMTLINE *l);
 
 static tmt_wchar_t
 tacs(const TMT *vt, unsigned char c)
@@ -103,96 +176,405 @@ tacs(const TMT *vt, unsigned char c)
     return (tmt_wchar_t)c;
 }
 
+static void
+markdirty(TMT *vt, size_t r)
+{
+    size_t i = (vt->top + r) % vt->screen.nline;
+    vt->dmap[i / 64] |= (uint64_t)1 << i % 64;
+}
+
+static void
+syncdirty(TMT *vt, size_t r, size_t e)
+{
+    /* Rows r to e - 1 have changed places; make their bits follow, and
+     * date them now for anyone going by generations.
+     */
+    uint64_t g = ++vt->gen;
+    for (size_t i = r; i < e; i++){
+        size_t j = (vt->top + i) % vt->screen.nline;
+        vt->screen.lines[i]->gen = g;
+        vt->dmap[j / 64] &= ~((uint64_t)1 << j % 64);
+        if (vt->screen.lines[i]->dirty)
+            markdirty(vt, i);
+    }
+}
+
+static size_t
+nextdirty(const TMT *vt, size_t i, size_t e)
+{
+    /* The first slot from i to e - 1 with its bit set, or e. */
+    while (i < e){
+        uint64_t w = vt->dmap[i / 64] >> i % 64;
+        if (!w){
+            i = (i / 64 + 1) * 64;
+            continue;
+        }
+        for (; !(w & 1); w >>= 1)
+            i++;
+        return MIN(i, e);
+    }
+    return e;
+}
+
+static void
+keepshown(TMT *vt, size_t r)
+{
+    /* A clean row still holds what the program has on it, so keep a
+     * copy for settle() to compare against.
+     */
+    TMTLINE *l = vt->screen.lines[r];
+    if (l->dirty) return;
+    memcpy(vt->shown[r].chars, l->chars, vt->screen.ncol * sizeof(TMTCHAR));
+    vt->shown[r].known = true;
+}
+
+static void
+damage(TMT *vt, size_t r, size_t s, size_t e)
+{
+    /* Columns s to e - 1 of row r are about to change; widen its damage
+     * to match.
+     */
+    TMTLINE *l = vt->screen.lines[r];
+    if (s >= e) return;
+    if (!l->dirty){
+        keepshown(vt, r);
+        l->dmin = s;
+        l->dmax = e - 1;
+    } else {
+        l->dmin = MIN(l->dmin, s);
+        l->dmax = MAX(l->dmax, e - 1);
+    }
+    vt->dirty = l->dirty = true;
+    l->gen = ++vt->gen;
+    markdirty(vt, r);
+}
+
+static void
+touchlines(TMT *vt, size_t s, size_t e)
+{
+    /* Rows s to e - 1 have changed completely. */
+    uint64_t g = ++vt->gen;
+    vt->dirty = true;
+    for (size_t i = s; i < e; i++){
+        TMTLINE *l = vt->screen.lines[i];
+        l->dirty = true;
+        l->gen = g;
+        l->dmin = 0;
+        l->dmax = vt->screen.ncol - 1;
+        markdirty(vt, i);
+    }
+}
+
 static void
 dirtylines(TMT *vt, size_t s, size_t e)
 {
+    /* Once every line is dirty, a scroll only moves dirty lines around,
+     * so there's no need to visit them again until tmt_clean().
+     */
     vt->dirty = true;
-    for (size_t i = s; i < e; i++)
-        vt->screen.lines[i]->dirty = true;
+    if (vt->alldirty) return;
+    touchlines(vt, s, e);
+    vt->alldirty = s == 0 && e == vt->screen.nline;
 }
 
 static void
-clearline(TMT *vt, TMTLINE *l, size_t s, size_t e)
+blankcells(TMT *vt, TMTLINE *l, size_t s, size_t e)
 {
-    vt->dirty = l->dirty = true;
+    if (s < e && e >= vt->screen.ncol)
+        l->wrapped = false;
     for (size_t i = s; i < e && i < vt->screen.ncol; i++){
-        l->chars[i].a = defattrs;
+        l->chars[i].style = 0;
         l->chars[i].c = L' ';
 		l->chars[i].char_type = TMT_HALFWIDTH;
-		l->chars[i].num_marks = 0;
+		l->chars[i].marks = 0;
     }
 }
 
+static void
+clearline(TMT *vt, size_t r, size_t s, size_t e)
+{
+    /* Cells that were blank already don't count as damage. Once the
+     * row is dirty, settle() sorts that out, if anything can.
+     */
+    TMTLINE *l = vt->screen.lines[r];
+    size_t a = s, b = MIN(e, vt->screen.ncol);
+    if (!l->dirty){
+        while (a < b && BLANK(&l->chars[a]))
+            a++;
+        while (b > a && BLANK(&l->chars[b - 1]))
+            b--;
+    }
+    damage(vt, r, a, b);
+    blankcells(vt, l, s, e);
+}
+
 static void
 clearlines(TMT *vt, size_t r, size_t n)
 {
     for (size_t i = r; i < r + n && i < vt->screen.nline; i++)
-        clearline(vt, vt->screen.lines[i], 0, vt->screen.ncol);
+        clearline(vt, i, 0, vt->screen.ncol);
 }
 
 static void
-savescroll(TMT *vt, TMTLINE **lines, size_t n) 
+syncring(TMT *vt, size_t r, size_t n)
+{
+    /* vt->ring holds every line pointer twice, so that the screen's
+     * lines, a window into it starting at vt->top, are contiguous however
+     * far it has rotated. Copy rows r to r + n - 1 to their twins.
+     */
+    size_t nl = vt->screen.nline;
+    for (size_t i = vt->top + r; i < vt->top + r + n; i++)
+        vt->ring[i < nl? i + nl : i - nl] = vt->ring[i];
+}
+
+static TMTLINE *allocline(TMT *vt, TMTLINE *o, size_t n, size_t pc);
+
+static bool
+growscroll(TMT *vt, size_t n)
 {
-	for (int i=0; i<n; i++) {
-		vt->scroll.lines[i]->dirty = true;
-		memcpy(vt->scroll.lines[i]->chars, lines[i]->chars, vt->screen.ncol * sizeof(TMTCHAR));
+    /* The scroll screen is a pool of szscroll lines, of which the first
+     * scroll.nline have scrolled off and not been reported yet.
+     */
+    if (n <= vt->szscroll) return true;
+    TMTLINE **sl = realloc(vt->scroll.lines, n * sizeof(TMTLINE *));
+    if (!sl) return false;
+    vt->scroll.lines = sl;
+    for (; vt->szscroll < n; vt->szscroll++){
+        TMTLINE *l = allocline(vt, NULL, vt->scroll.ncol, 0);
+        if (!l) return false;
+        sl[vt->szscroll] = l;
+    }
+    return true;
+}
+
+static void
+flushscroll(TMT *vt)
+{
+    if (!vt->scroll.nline) return;
+    CB(vt, TMT_MSG_SCROLL, &vt->scroll);
+    vt->scroll.nline = 0;
+}
+
+static void
+savescroll(TMT *vt, size_t n) 
+{
+	/* Hand the top n screen lines to the scroll screen by swapping
+	 * pointers; the screen gets pool lines back, which the caller is
+	 * about to clear anyway. They're reported together at the end of
+	 * tmt_write(), or sooner if the pool can't grow.
+	 */
+	size_t want = vt->scroll.nline + n;
+	size_t cap = MAX(vt->screen.nline, SCROLL_MAX);
+	if (want > vt->szscroll &&
+	    (want > cap || !growscroll(vt, MIN(cap, MAX(want, vt->szscroll * 2)))))
+		flushscroll(vt);
+
+	TMTLINE **sl = vt->scroll.lines + vt->scroll.nline;
+	for (size_t i = 0; i < n; i++) {
+		TMTLINE *l = vt->screen.lines[i];
+		vt->screen.lines[i] = sl[i];
+		sl[i] = l;
+		l->dirty = true;
+		if (vt->hist.maxlines || vt->hist.maxbytes)
+			pushhistory(vt, l);
 	}
-	CB(vt, TMT_MSG_SCROLL, &vt->scroll);
+	vt->scroll.nline += n;
+	syncring(vt, 0, n);
+	touchlines(vt, 0, n);
 }
 
 static void
-scrup(TMT *vt, size_t r, size_t n)
+reverselines(TMTLINE **l, size_t s, size_t e)
 {
-    n = MIN(n, vt->screen.nline - 1 - r);
+    for (; s + 1 < e; s++, e--){
+        TMTLINE *t = l[s];
+        l[s] = l[e - 1];
+        l[e - 1] = t;
+    }
+}
 
-    if (n){
-        TMTLINE** buf = malloc(n * sizeof(TMTLINE*));
+static void
+rotate(TMT *vt, size_t r, size_t e, size_t n)
+{
+    /* Rotate rows r to e - 1 up by n. Scrolling the whole screen just
+     * moves the window, and dates every row at once; anything else swaps
+     * pointers.
+     */
+    size_t nl = vt->screen.nline;
+    if (r == 0 && e == nl){
+        vt->top = (vt->top + n) % nl;
+        vt->screen.lines = vt->ring + vt->top;
+        vt->scrollgen = ++vt->gen;
+        return;
+    }
+    reverselines(vt->screen.lines, r, r + n);
+    reverselines(vt->screen.lines, r + n, e);
+    reverselines(vt->screen.lines, r, e);
+    syncring(vt, r, e - r);
+    syncdirty(vt, r, e);
+}
+
+static void
+reverseshown(SHOWN *s, size_t b, size_t e)
+{
+    for (; b + 1 < e; b++, e--){
+        SHOWN t = s[b];
+        s[b] = s[e - 1];
+        s[e - 1] = t;
+    }
+}
 
-        memcpy(buf, vt->screen.lines + r, n * sizeof(TMTLINE *));
-        memmove(vt->screen.lines + r, vt->screen.lines + r + n,
-                (vt->screen.nline - n - r) * sizeof(TMTLINE *));
-        memcpy(vt->screen.lines + (vt->screen.nline - n),
-               buf, n * sizeof(TMTLINE *));
+static void
+shiftlines(TMT *vt, size_t r, size_t e, ptrdiff_t n)
+{
+    /* If the program moves rows itself, only the rows the caller cleared
+     * need repainting. Once everything is dirty there's no point.
+     */
+    if (!vt->shifts || !vt->cb || vt->alldirty){
+        dirtylines(vt, r, e);
+        return;
+    }
+    TMTSHIFT sh = {r, e, n};
+    CB(vt, TMT_MSG_SHIFT, &sh);
 
-		if (r == 0) {
-			savescroll(vt, buf, n);
-		}
-        clearlines(vt, vt->screen.nline - n, n);
-        dirtylines(vt, r, vt->screen.nline);
-        free(buf);
+    /* The program's rows moved, so what it has on each changes too; the
+     * rows left behind hold who knows what.
+     */
+    size_t k = n > 0? (size_t)n : e - r - (size_t)-n;
+    reverseshown(vt->shown, r, r + k);
+    reverseshown(vt->shown, r + k, e);
+    reverseshown(vt->shown, r, e);
+    for (size_t i = n > 0? e - k : r; i < (n > 0? e : e - k); i++)
+        vt->shown[i].known = false;
+}
+
+static void
+scrup(TMT *vt, size_t r, size_t n)
+{
+    /* Scroll rows r to the bottom margin up by n. Only lines leaving a
+     * full-screen region go to the scroll screen.
+     */
+    size_t e = vt->mbot;
+    n = MIN(n, e - 1 - r);
+
+    if (n){
+        if (r == 0 && e == vt->screen.nline && !vt->alt)
+            savescroll(vt, n);
+        rotate(vt, r, e, n);
+        touchlines(vt, e - n, e);
+        clearlines(vt, e - n, n);
+        shiftlines(vt, r, e, (ptrdiff_t)n);
     }
 }
 
 static void
 scrdn(TMT *vt, size_t r, size_t n)
 {
-    n = MIN(n, vt->screen.nline - 1 - r);
+    size_t e = vt->mbot;
+    n = MIN(n, e - 1 - r);
 
     if (n){
-        TMTLINE** buf = malloc(n * sizeof(TMTLINE*));
-
-        memcpy(buf, vt->screen.lines + (vt->screen.nline - n),
-               n * sizeof(TMTLINE *));
-        memmove(vt->screen.lines + r + n, vt->screen.lines + r,
-                (vt->screen.nline - n - r) * sizeof(TMTLINE *));
-        memcpy(vt->screen.lines + r, buf, n * sizeof(TMTLINE *));
-    
+        rotate(vt, r, e, e - r - n);
+        touchlines(vt, r, r + n);
         clearlines(vt, r, n);
-        dirtylines(vt, r, vt->screen.nline);
-        free(buf);
+        shiftlines(vt, r, e, -(ptrdiff_t)n);
     }
 }
 
+static void
+linefeed(TMT *vt)
+{
+    TMTPOINT *c = &vt->curs;
+    if (c->r == vt->mbot - 1)
+        scrup(vt, vt->mtop, 1);
+    else if (c->r < vt->screen.nline - 1)
+        c->r++;
+}
+
+static void
+revlinefeed(TMT *vt)
+{
+    TMTPOINT *c = &vt->curs;
+    if (c->r == vt->mtop)
+        scrdn(vt, vt->mtop, 1);
+    else if (c->r)
+        c->r--;
+}
+
+static void
+swapscreens(TMT *vt)
+{
+    TMTLINE **r = vt->ring;
+    size_t t = vt->top;
+    vt->ring = vt->altring;
+    vt->top = vt->alttop;
+    vt->altring = r;
+    vt->alttop = t;
+    vt->screen.lines = vt->ring + vt->top;
+    vt->alldirty = false;
+}
+
+static void
+altscreen(TMT *vt, bool on, size_t mode)
+{
+    /* Modes 47, 1047 and 1049 switch between the main and alternate
+     * screens by swapping rings; the alternate one is made the first
+     * time it's needed. 1047 clears it on the way out, and 1049 saves the
+     * cursor and clears it on the way in instead.
+     */
+    size_t nl = vt->screen.nline;
+    if (on == vt->alt) return;
+    if (on && !vt->altring){
+        TMTLINE **r = calloc(2 * nl, sizeof(TMTLINE *));
+        if (!r) return;
+        for (size_t i = 0; i < nl; i++)
+            if (!(r[i] = r[i + nl] = allocline(vt, NULL, vt->screen.ncol, 0))){
+                for (size_t j = 0; j < i; j++)
+                    free(r[j]);
+                free(r);
+                return;
+            }
+        vt->altring = r;
+        vt->alttop = 0;
+    }
+
+    if (on && mode == 1049){
+        vt->oldcurs = vt->curs;
+        vt->oldattrs = vt->attrs;
+    }
+    if (!on && mode != 47)
+        clearlines(vt, 0, nl);
+    swapscreens(vt);
+    vt->alt = on;
+    dirtylines(vt, 0, nl);
+    if (on && mode == 1049)
+        clearlines(vt, 0, nl);
+    if (!on && mode == 1049){
+        vt->curs = vt->oldcurs;
+        vt->attrs = vt->oldattrs;
+        setstyle(vt);
+    }
+}
+
+#define INREGION(vt) ((vt)->curs.r >= (vt)->mtop && (vt)->curs.r < (vt)->mbot)
+
 HANDLER(ed)
     size_t b = 0;
     size_t e = s->nline;
 
     switch (P0(0)){
-        case 0: b = c->r + 1; clearline(vt, l, c->c, vt->screen.ncol); break;
-        case 1: e = c->r - 1; clearline(vt, l, 0, c->c);               break;
-        case 2:  
-			savescroll(vt, vt->screen.lines, vt->screen.nline);
-			break;
+        case 0: b = c->r + 1; clearline(vt, CROW(vt), c->c, s->ncol); break;
+        case 1: e = c->r - 1; clearline(vt, CROW(vt), 0, c->c);       break;
+        case 2:
+            /* The rows go to the scroll screen, but the program still
+             * has them up until it's redrawn.
+             */
+            if (!vt->alt){
+                for (size_t r = 0; r < s->nline; r++)
+                    keepshown(vt, r);
+                savescroll(vt, vt->screen.nline);
+            }
+            break;
         default: /* do nothing   */                                    return;
     }
 
@@ -200,13 +582,15 @@ HANDLER(ed)
 }
 
 HANDLER(ich)
+    if (c->c >= s->ncol) return;
     size_t n = P1(0); /* XXX use MAX */
     if (n > s->ncol - c->c - 1) n = s->ncol - c->c - 1;
 
+    damage(vt, CROW(vt), c->c, s->ncol);
     memmove(l->chars + c->c + n, l->chars + c->c,
             MIN(s->ncol - 1 - c->c,
             (s->ncol - c->c - n - 1)) * sizeof(TMTCHAR));
-    clearline(vt, l, c->c, n);
+    clearline(vt, CROW(vt), c->c, n);
 }
 
 HANDLER(dch)
@@ -214,10 +598,11 @@ HANDLER(dch)
     if (n > s->ncol - c->c) n = s->ncol - c->c;
     else if (n == 0) return;
 
+    damage(vt, CROW(vt), c->c, s->ncol);
     memmove(l->chars + c->c, l->chars + c->c + n,
             (s->ncol - c->c - n) * sizeof(TMTCHAR));
 
-    clearline(vt, l, s->ncol - n, s->ncol);
+    clearline(vt, CROW(vt), s->ncol - n, s->ncol);
     /* VT102 manual says the attribute for the newly empty characters
      * should be the same as the last character moved left, which isn't
      * what clearline() currently does.
@@ -226,9 +611,9 @@ HANDLER(dch)
 
 HANDLER(el)
     switch (P0(0)){
-        case 0: clearline(vt, l, c->c, vt->screen.ncol);         break;
-        case 1: clearline(vt, l, 0, MIN(c->c + 1, s->ncol - 1)); break;
-        case 2: clearline(vt, l, 0, vt->screen.ncol);            break;
+        case 0: clearline(vt, CROW(vt), c->c, s->ncol);                 break;
+        case 1: clearline(vt, CROW(vt), 0, MIN(c->c + 1, s->ncol - 1)); break;
+        case 2: clearline(vt, CROW(vt), 0, s->ncol);                    break;
     }
 }
 
@@ -240,13 +625,14 @@ HANDLER(sgr)
     #define FGBGBLU() *(P0(i) < 40? &vt->attrs.fg.blue : &vt->attrs.bg.blue) = (i < vt->npar-4) ? vt->pars[i+4] : 0
     for (size_t i = 0; i < vt->npar; i++) switch (P0(i)){
         case  0: vt->attrs                    = defattrs;   break;
-        case  1: case 22: vt->attrs.bold      = P0(0) < 20; break;
-        case  2: case 23: vt->attrs.dim       = P0(0) < 20; break;
-        case  4: case 24: vt->attrs.underline = P0(0) < 20; break;
-        case  5: case 25: vt->attrs.blink     = P0(0) < 20; break;
-        case  7: case 27: vt->attrs.reverse   = P0(0) < 20; break;
-        case  8: case 28: vt->attrs.invisible = P0(0) < 20; break;
-        case 10: case 11: vt->acs             = P0(0) > 10; break;
+        case  1: vt->attrs.bold               = true;       break;
+        case 22: vt->attrs.bold = vt->attrs.dim = false;    break;
+        case  2: case 23: vt->attrs.dim       = P0(i) < 20; break;
+        case  4: case 24: vt->attrs.underline = P0(i) < 20; break;
+        case  5: case 25: vt->attrs.blink     = P0(i) < 20; break;
+        case  7: case 27: vt->attrs.reverse   = P0(i) < 20; break;
+        case  8: case 28: vt->attrs.invisible = P0(i) < 20; break;
+        case 10: case 11: vt->acs             = P0(i) > 10; break;
         case 30: case 40: FGBG(TMT_COLOR_BLACK);            break;
         case 31: case 41: FGBG(TMT_COLOR_RED);              break;
         case 32: case 42: FGBG(TMT_COLOR_GREEN);            break;
@@ -260,7 +646,9 @@ HANDLER(sgr)
 						 	  FGBGRED(); 
 							  FGBGGRN(); 
 							  FGBGBLU(); 
-						  }
+							  i += 4;
+						  } else if ((i < vt->npar-1) && (vt->pars[i+1] == 5))
+							  i += 2; /* indexed colors aren't supported */
 						  break;
         case 39: case 49: FGBG(TMT_COLOR_DEFAULT);          break;
         case 90: case 100: FGBGB(TMT_COLOR_BRIGHT_BLACK);   break;
@@ -272,6 +660,7 @@ HANDLER(sgr)
         case 96: case 106: FGBGB(TMT_COLOR_BRIGHT_CYAN);    break;
         case 97: case 107: FGBGB(TMT_COLOR_BRIGHT_WHITE);   break;
     }
+    setstyle(vt);
 }
 
 HANDLER(rep)
@@ -287,11 +676,36 @@ HANDLER(dsr)
     CB(vt, TMT_MSG_ANSWER, (const char *)r);
 }
 
+HANDLER(decstbm)
+    size_t top = P1(0), bot = P0(1)? P0(1) : s->nline;
+    if (top >= bot || bot > s->nline) return;
+    vt->mtop = top - 1;
+    vt->mbot = bot;
+    c->r = c->c = 0;
+}
+
+static void
+setmode(TMT *vt, bool on)
+{
+    for (size_t i = 0; i < vt->npar; i++) switch (P0(i)){
+        case 25: CB(vt, TMT_MSG_CURSOR, on? "t" : "f");  break;
+        case 47: case 1047: case 1049: altscreen(vt, on, P0(i)); break;
+    }
+}
+
 HANDLER(resetparser)
     memset(vt->pars, 0, sizeof(vt->pars));
     vt->state = vt->npar = vt->arg = vt->ignored = (bool)0;
 }
 
+static void
+endsequence(TMT *vt)
+{
+    /* Text cuts short any sequence in progress. */
+    if (vt->state != S_NUL || vt->npar || vt->arg || vt->ignored)
+        resetparser(vt);
+}
+
 HANDLER(consumearg)
     if (vt->npar < PAR_MAX)
         vt->pars[vt->npar++] = vt->arg;
@@ -307,72 +721,138 @@ HANDLER(fixcursor)
     c->c = MIN(c->c, s->ncol - 1);
 }
 
+/* Parser actions. Everything below A_DO just moves the parser along;
+ * everything from A_DO up completes a control function, which consumes
+ * the pending argument, runs, and resets the parser.
+ */
+enum{
+    A_NONE, A_IGN, A_ESC, A_CSI, A_OSC, A_OSEND, A_SPA, A_SCS, A_SEP, A_NUM,
+    A_DO,
+    A_BEL = A_DO, A_BS, A_HT, A_LF, A_CR, A_HTS, A_SC, A_RC, A_RIS, A_CUU,
+    A_CUD, A_CUF, A_CUB, A_CNL, A_CPL, A_CHA, A_VPA, A_CUP, A_CHT, A_ED,
+    A_EL, A_IL, A_DL, A_DCH, A_SU, A_SD, A_ECH, A_CBT, A_REP, A_DA, A_TBC,
+    A_SGR, A_DSR, A_SM, A_MC, A_RM, A_ICH, A_CURSTY, A_IND, A_RI, A_NEL,
+    A_STBM
+};
+
+/* Transition table, indexed by parser state and input byte. Bytes with
+ * no entry (A_NONE) end any sequence in progress and are treated as text,
+ * except in S_OS where everything up to the terminator is swallowed.
+ */
+static const unsigned char actions[][UCHAR_MAX + 1] = {
+    [S_NUL] = {
+        [0x00] = A_IGN, [0x07] = A_BEL, [0x08] = A_BS, [0x09] = A_HT,
+        [0x0a] = A_LF,  [0x0d] = A_CR,  [0x1b] = A_ESC
+    },
+    [S_ESC] = {
+        [0x00] = A_IGN, [0x1b] = A_ESC, ['H'] = A_HTS, ['7'] = A_SC,
+        ['8'] = A_RC,   ['+'] = A_SCS,  ['*'] = A_SCS, ['('] = A_SCS,
+        [')'] = A_SCS,  ['c'] = A_RIS,  ['['] = A_CSI, [']'] = A_OSC,
+        ['D'] = A_IND,  ['M'] = A_RI,   ['E'] = A_NEL
+    },
+    [S_ARG] = {
+        [0x00] = A_IGN, [0x1b] = A_ESC, [';'] = A_SEP, ['?'] = A_IGN,
+        ['0'] = A_NUM,  ['1'] = A_NUM,  ['2'] = A_NUM, ['3'] = A_NUM,
+        ['4'] = A_NUM,  ['5'] = A_NUM,  ['6'] = A_NUM, ['7'] = A_NUM,
+        ['8'] = A_NUM,  ['9'] = A_NUM,  ['A'] = A_CUU, ['B'] = A_CUD,
+        ['C'] = A_CUF,  ['D'] = A_CUB,  ['E'] = A_CNL, ['F'] = A_CPL,
+        ['G'] = A_CHA,  ['d'] = A_VPA,  ['H'] = A_CUP, ['f'] = A_CUP,
+        ['I'] = A_CHT,  ['J'] = A_ED,   ['K'] = A_EL,  ['L'] = A_IL,
+        ['M'] = A_DL,   ['P'] = A_DCH,  ['S'] = A_SU,  ['T'] = A_SD,
+        ['X'] = A_ECH,  ['Z'] = A_CBT,  ['b'] = A_REP, ['c'] = A_DA,
+        ['g'] = A_TBC,  ['m'] = A_SGR,  ['n'] = A_DSR, ['h'] = A_SM,
+        ['i'] = A_MC,   ['l'] = A_RM,   ['s'] = A_SC,  ['u'] = A_RC,
+        [' '] = A_SPA,  ['@'] = A_ICH,  ['r'] = A_STBM
+    },
+    [S_OS] = {
+        [0x1b] = A_ESC, [0x07] = A_OSEND
+    },
+    [S_SPA] = {
+        [0x00] = A_IGN, ['q'] = A_CURSTY
+    }
+};
+
+static void
+docontrol(TMT *vt, unsigned char a)
+{
+    COMMON_VARS;
+
+    switch (a){
+        case A_BEL: CB(vt, TMT_MSG_BELL, NULL);                              break;
+        case A_BS:  if (c->c) c->c--;                                        break;
+        case A_HT:  while (++c->c < s->ncol - 1 && t[c->c].c != L'*');       break;
+        case A_LF:  linefeed(vt);                                            break;
+        case A_CR:  c->c = 0;                                                break;
+        case A_HTS: t[MIN(c->c, s->ncol - 1)].c = L'*';                      break;
+        case A_SC:  vt->oldcurs = vt->curs; vt->oldattrs = vt->attrs;        break;
+        case A_RC:  vt->curs = vt->oldcurs; vt->attrs = vt->oldattrs;
+                    setstyle(vt);                                            break;
+        case A_RIS: tmt_reset(vt);                                           break;
+        case A_CUU: c->r -= MIN(c->r, P1(0));                                break;
+        case A_CUD: c->r = MIN(c->r + P1(0), s->nline - 1);                  break;
+        case A_CUF: c->c = MIN(c->c + P1(0), s->ncol - 1);                   break;
+        case A_CUB: c->c -= MIN(c->c, P1(0));                                break;
+        case A_CNL: c->c = 0; c->r = MIN(c->r + P1(0), s->nline - 1);        break;
+        case A_CPL: c->c = 0; c->r -= MIN(c->r, P1(0));                      break;
+        case A_CHA: c->c = MIN(P1(0) - 1, s->ncol - 1);                      break;
+        case A_VPA: c->r = MIN(P1(0) - 1, s->nline - 1);                     break;
+        case A_CUP: c->r = P1(0) - 1; c->c = P1(1) - 1;                      break;
+        case A_CHT: while (++c->c < s->ncol - 1 && t[c->c].c != L'*');       break;
+        case A_ED:  ed(vt);                                                  break;
+        case A_EL:  el(vt);                                                  break;
+        case A_IL:  if (INREGION(vt)) scrdn(vt, c->r, P1(0));                break;
+        case A_DL:  if (INREGION(vt)) scrup(vt, c->r, P1(0));                break;
+        case A_DCH: dch(vt);                                                 break;
+        case A_SU:  scrup(vt, vt->mtop, P1(0));                              break;
+        case A_SD:  scrdn(vt, vt->mtop, P1(0));                              break;
+        case A_ECH: clearline(vt, CROW(vt), c->c, c->c + P1(0));             break;
+        case A_CBT: while (c->c && t[--c->c].c != L'*');                     break;
+        case A_REP: rep(vt);                                                 break;
+        case A_DA:  CB(vt, TMT_MSG_ANSWER, "\033[?6c");                      break;
+        case A_TBC: if (P0(0) == 3) blankcells(vt, vt->tabs, 0, s->ncol);    break;
+        case A_SGR: sgr(vt);                                                 break;
+        case A_DSR: if (P0(0) == 6) dsr(vt);                                 break;
+        case A_SM:  setmode(vt, true);                                       break;
+        case A_MC:  /* no printer attached */                                break;
+        case A_RM:  setmode(vt, false);                                      break;
+        case A_ICH: ich(vt);                                                 break;
+        case A_CURSTY: setcursty(vt);                                        break;
+        case A_IND: linefeed(vt);                                            break;
+        case A_RI:  revlinefeed(vt);                                         break;
+        case A_NEL: c->c = 0; linefeed(vt);                                  break;
+        case A_STBM: decstbm(vt);                                            break;
+    }
+}
+
 static bool
 handlechar(TMT *vt, char i)
 {
-    COMMON_VARS;
+    unsigned char a = actions[vt->state][(unsigned char)i];
+
+    switch (a){
+        case A_NONE:
+            if (vt->state == S_OS)
+                return true;
+            endsequence(vt);
+            return false;
+
+        case A_IGN:   return true;
+        case A_ESC:   vt->state = S_ESC;                      return true;
+        case A_CSI:   vt->state = S_ARG;                      return true;
+        case A_OSC:   vt->state = S_OS;                       return true;
+        case A_OSEND: vt->state = S_NUL;                      return true;
+        case A_SPA:   vt->state = S_SPA;                      return true;
+        case A_SCS:   vt->ignored = true; vt->state = S_ARG;  return true;
+        case A_SEP:   consumearg(vt);                         return true;
+        case A_NUM:   vt->arg = vt->arg * 10 + (i - '0');     return true;
+    }
 
-    char cs[] = {i, 0};
-    #define ON(S, C, A) if (vt->state == (S) && strchr(C, i)){ A; return true;}
-    #define DO(S, C, A) ON(S, C, consumearg(vt); if (!vt->ignored) {A;} \
-                                 fixcursor(vt); resetparser(vt););
-	#define SK(S) if (vt->state == (S)) { return true; }
-
-    DO(S_NUL, "\x07",       CB(vt, TMT_MSG_BELL, NULL))
-    DO(S_NUL, "\x08",       if (c->c) c->c--)
-    DO(S_NUL, "\x09",       while (++c->c < s->ncol - 1 && t[c->c].c != L'*'))
-    DO(S_NUL, "\x0a",       c->r < s->nline - 1? (void)c->r++ : scrup(vt, 0, 1))
-    DO(S_NUL, "\x0d",       c->c = 0)
-    ON(S_NUL, "\x1b",       vt->state = S_ESC)
-    ON(S_ESC, "\x1b",       vt->state = S_ESC)
-    DO(S_ESC, "H",          t[c->c].c = L'*')
-    DO(S_ESC, "7",          vt->oldcurs = vt->curs; vt->oldattrs = vt->attrs)
-    DO(S_ESC, "8",          vt->curs = vt->oldcurs; vt->attrs = vt->oldattrs)
-    ON(S_ESC, "+*()",       vt->ignored = true; vt->state = S_ARG)
-    DO(S_ESC, "c",          tmt_reset(vt))
-    ON(S_ESC, "[",          vt->state = S_ARG)
-    ON(S_ESC, "]",          vt->state = S_OS)
-    ON(S_OS,  "\x1b",       vt->state = S_ESC)
-    ON(S_OS,  "\x07",       vt->state = S_NUL)
-	SK(S_OS)
-	DO(S_SPA, "q",          setcursty(vt))
-    ON(S_ARG, "\x1b",       vt->state = S_ESC)
-    ON(S_ARG, ";",          consumearg(vt))
-    ON(S_ARG, "?",          (void)0)
-    ON(S_ARG, "0123456789", vt->arg = vt->arg * 10 + atoi(cs))
-    DO(S_ARG, "A",          c->r = MAX(c->r - P1(0), 0))
-    DO(S_ARG, "B",          c->r = MIN(c->r + P1(0), s->nline - 1))
-    DO(S_ARG, "C",          c->c = MIN(c->c + P1(0), s->ncol - 1))
-    DO(S_ARG, "D",          c->c = MIN(c->c - P1(0), c->c))
-    DO(S_ARG, "E",          c->c = 0; c->r = MIN(c->r + P1(0), s->nline - 1))
-    DO(S_ARG, "F",          c->c = 0; c->r = MAX(c->r - P1(0), 0))
-    DO(S_ARG, "G",          c->c = MIN(P1(0) - 1, s->ncol - 1))
-    DO(S_ARG, "d",          c->r = MIN(P1(0) - 1, s->nline - 1))
-    DO(S_ARG, "Hf",         c->r = P1(0) - 1; c->c = P1(1) - 1)
-    DO(S_ARG, "I",          while (++c->c < s->ncol - 1 && t[c->c].c != L'*'))
-    DO(S_ARG, "J",          ed(vt))
-    DO(S_ARG, "K",          el(vt))
-    DO(S_ARG, "L",          scrdn(vt, c->r, P1(0)))
-    DO(S_ARG, "M",          scrup(vt, c->r, P1(0)))
-    DO(S_ARG, "P",          dch(vt))
-    DO(S_ARG, "S",          scrup(vt, 0, P1(0)))
-    DO(S_ARG, "T",          scrdn(vt, 0, P1(0)))
-    DO(S_ARG, "X",          clearline(vt, l, c->c, c->c + P1(0)))
-    DO(S_ARG, "Z",          while (c->c && t[--c->c].c != L'*'))
-    DO(S_ARG, "b",          rep(vt));
-    DO(S_ARG, "c",          CB(vt, TMT_MSG_ANSWER, "\033[?6c"))
-    DO(S_ARG, "g",          if (P0(0) == 3) clearline(vt, vt->tabs, 0, s->ncol))
-    DO(S_ARG, "m",          sgr(vt))
-    DO(S_ARG, "n",          if (P0(0) == 6) dsr(vt))
-    DO(S_ARG, "h",          if (P0(0) == 25) CB(vt, TMT_MSG_CURSOR, "t"))
-    DO(S_ARG, "i",          (void)0)
-    DO(S_ARG, "l",          if (P0(0) == 25) CB(vt, TMT_MSG_CURSOR, "f"))
-    DO(S_ARG, "s",          vt->oldcurs = vt->curs; vt->oldattrs = vt->attrs)
-    DO(S_ARG, "u",          vt->curs = vt->oldcurs; vt->attrs = vt->oldattrs)
-    ON(S_ARG, " ",          vt->state = S_SPA)
-    DO(S_ARG, "@",          ich(vt))
-
-    return resetparser(vt), false;
+    consumearg(vt);
+    if (!vt->ignored)
+        docontrol(vt, a);
+    fixcursor(vt);
+    resetparser(vt);
+    return true;
 }
 
 static void
@@ -384,13 +864,53 @@ notify(TMT *vt, bool update, bool moved)
 	//if (scroll) CB(vt, TMT_MSG_SCROLL, &vt->scroll);
 }
 
+static void
+settle(TMT *vt)
+{
+    /* Programs that redraw everything mostly rewrite what's there, often
+     * erasing it first. Narrow each dirty row's damage down to the cells
+     * that really differ from what was on it at the last tmt_clean(), and
+     * clean it if none do. When everything has moved there's no point.
+     */
+    size_t nl = vt->screen.nline;
+    bool dirty = false;
+    if (vt->alldirty) return;
+    for (size_t r = tmt_next_dirty(vt, 0); r < nl; r = tmt_next_dirty(vt, r + 1)){
+        TMTLINE *l = vt->screen.lines[r];
+        const TMTCHAR *o = vt->shown[r].chars;
+        size_t a = l->dmin, b = l->dmax + 1;
+        if (!vt->shown[r].known){
+            dirty = true;
+            continue;
+        }
+        while (a < b && SAMECELL(&l->chars[a], &o[a]))
+            a++;
+        while (b > a && SAMECELL(&l->chars[b - 1], &o[b - 1]))
+            b--;
+        if (a == b){
+            size_t i = (vt->top + r) % nl;
+            vt->dmap[i / 64] &= ~((uint64_t)1 << i % 64);
+            l->dirty = false;
+            continue;
+        }
+        l->dmin = a;
+        l->dmax = b - 1;
+        dirty = true;
+    }
+    vt->dirty = dirty;
+}
+
 static TMTLINE *
 allocline(TMT *vt, TMTLINE *o, size_t n, size_t pc)
 {
     TMTLINE *l = realloc(o, sizeof(TMTLINE) + n * sizeof(TMTCHAR));
     if (!l) return NULL;
 
-    clearline(vt, l, pc, n);
+    if (!o){
+        l->wrapped = l->dirty = false;
+        l->gen = 0;
+    }
+    blankcells(vt, l, pc, n);
     return l;
 }
 
@@ -401,13 +921,12 @@ freelines(TMT *vt, size_t s, size_t n, bool screen)
         free(vt->screen.lines[i]);
         vt->screen.lines[i] = NULL;
     }
-    if (screen) free(vt->screen.lines);
+    if (!screen) return;
+    free(vt->ring);
 
-    for (size_t i = s; vt->scroll.lines && i < s + n; i++){
+    for (size_t i = 0; vt->scroll.lines && i < vt->szscroll; i++)
         free(vt->scroll.lines[i]);
-        vt->scroll.lines[i] = NULL;
-    }
-    if (screen) free(vt->scroll.lines);
+    free(vt->scroll.lines);
 }
 
 TMT *
@@ -416,6 +935,7 @@ tmt_open(size_t nline, size_t ncol, TMTCALLBACK cb, void *p,
 {
     TMT *vt = calloc(1, sizeof(TMT));
     if (!nline || !ncol || !vt) return free(vt), NULL;
+    history_init(&vt->hist);
 
     /* ASCII-safe defaults for box-drawing characters. */
 #ifdef FORCE_UTF8
@@ -425,6 +945,14 @@ tmt_open(size_t nline, size_t ncol, TMTCALLBACK cb, void *p,
 #endif
     vt->cb = cb;
     vt->p = p;
+    vt->attrs = vt->oldattrs = defattrs;
+    vt->nmarks = 1;
+    vt->msweep = MARKS_SWEEP;
+    vt->nstyles = vt->szstyles = 1;
+    vt->ssweep = STYLES_SWEEP;
+    vt->styles = malloc(sizeof(STYLE));
+    if (!vt->styles) return free(vt), NULL;
+    vt->styles[0].a = defattrs;
 
     if (!tmt_resize(vt, nline, ncol)) return tmt_close(vt), NULL;
     return vt;
@@ -434,22 +962,48 @@ void
 tmt_close(TMT *vt)
 {
     free(vt->tabs);
+    if (vt->altring){
+        swapscreens(vt);
+        freelines(vt, 0, vt->screen.nline, false);
+        free(vt->ring);
+        swapscreens(vt);
+    }
     freelines(vt, 0, vt->screen.nline, true);
+    free(vt->marks);
+    free(vt->markbuf);
+    free(vt->styles);
+    history_free(&vt->hist);
+    free(vt->hbuf);
+    free(vt->hmap);
+    free(vt->hline);
+    free(vt->hlog);
+    free(vt->hbrk);
+    free(vt->hrows);
+    free(vt->dmap);
+    free(vt->shown);
+    free(vt->shownbuf);
     free(vt);
 }
 
-bool
-tmt_resize(TMT *vt, size_t nline, size_t ncol)
+static bool
+resizelines(TMT *vt, size_t onl, size_t pc, size_t nline, size_t ncol)
 {
-    if (nline < 2 || ncol < 2) return false;
-    if (nline < vt->screen.nline)
-        freelines(vt, nline, vt->screen.nline - nline, false);
+    /* Resize the showing screen's lines from onl by pc to nline by ncol,
+     * unrotating the ring as we go.
+     */
+    vt->screen.nline = onl;
+    if (nline < onl)
+        freelines(vt, nline, onl - nline, false);
 
-    TMTLINE **l = realloc(vt->screen.lines, nline * sizeof(TMTLINE *));
+    TMTLINE **l = malloc(2 * nline * sizeof(TMTLINE *));
     if (!l) return false;
 
-    size_t pc = vt->screen.ncol;
-    vt->screen.lines = l;
+    vt->screen.nline = MIN(nline, onl);
+    if (vt->screen.nline)
+        memcpy(l, vt->screen.lines, vt->screen.nline * sizeof(TMTLINE *));
+    free(vt->ring);
+    vt->ring = vt->screen.lines = l;
+    vt->top = 0;
     vt->screen.ncol = ncol;
     for (size_t i = 0; i < nline; i++){
         TMTLINE *nl = NULL;
@@ -463,71 +1017,310 @@ tmt_resize(TMT *vt, size_t nline, size_t ncol)
         vt->screen.lines[i] = nl;
     }
     vt->screen.nline = nline;
+    syncring(vt, 0, nline);
+    return true;
+}
 
-    TMTLINE **sl = realloc(vt->scroll.lines, nline * sizeof(TMTLINE *));
-    if (!sl) return false;
-
-    vt->scroll.lines = sl;
-    vt->scroll.ncol = ncol;
-    for (size_t i = 0; i < nline; i++){
-        TMTLINE *nl = NULL;
-        if (i >= vt->scroll.nline)
-            nl = vt->scroll.lines[i] = allocline(vt, NULL, ncol, 0);
-        else
-            nl = allocline(vt, vt->scroll.lines[i], ncol, pc);
+bool
+tmt_resize(TMT *vt, size_t nline, size_t ncol)
+{
+    if (nline < 2 || ncol < 2) return false;
 
+    /* Only the main screen is rewrapped; programs using the alternate
+     * one redraw it themselves.
+     */
+    size_t onl = vt->screen.nline, pc = vt->screen.ncol;
+    if (vt->alt) swapscreens(vt);
+    bool ok = pc && pc != ncol? reflow(vt, onl, pc, nline, ncol, !vt->alt)
+                              : resizelines(vt, onl, pc, nline, ncol);
+    if (ok && vt->altring){
+        swapscreens(vt);
+        ok = resizelines(vt, onl, pc, nline, ncol);
+        if (!vt->alt) swapscreens(vt);
+    } else if (vt->alt)
+        swapscreens(vt);
+    if (!ok) return false;
+
+    vt->mtop = 0;
+    vt->mbot = nline;
+
+    for (size_t i = 0; i < vt->szscroll; i++){
+        TMTLINE *nl = allocline(vt, vt->scroll.lines[i], ncol, pc);
         if (!nl) return false;
-		nl->dirty = false;
         vt->scroll.lines[i] = nl;
     }
-    vt->scroll.nline = nline;
+    vt->scroll.ncol = ncol;
+    if (!growscroll(vt, nline)) return false;
 
     vt->tabs = allocline(vt, vt->tabs, ncol, 0);
-    if (!vt->tabs) return free(l), false;
+    if (!vt->tabs) return false;
     vt->tabs->chars[0].c = vt->tabs->chars[ncol - 1].c = L'*';
     for (size_t i = 0; i < ncol; i++) if (i % TAB == 0)
         vt->tabs->chars[i].c = L'*';
 
+    uint64_t *m = realloc(vt->dmap, (nline + 63) / 64 * sizeof(uint64_t));
+    if (!m) return false;
+    vt->dmap = m;
+    memset(m, 0, (nline + 63) / 64 * sizeof(uint64_t));
+
+    SHOWN *sh = realloc(vt->shown, nline * sizeof(SHOWN));
+    if (!sh) return false;
+    vt->shown = sh;
+    TMTCHAR *sb = realloc(vt->shownbuf, nline * ncol * sizeof(TMTCHAR));
+    if (!sb) return false;
+    vt->shownbuf = sb;
+    for (size_t i = 0; i < nline; i++)
+        sh[i] = (SHOWN){sb + i * ncol, false};
+
     fixcursor(vt);
+    vt->alldirty = false;
     dirtylines(vt, 0, nline);
     //notify(vt, true, true, false);
     notify(vt, true, true);
     return true;
 }
 
+static size_t
+hashmarks(const tmt_wchar_t *m, size_t n)
+{
+    size_t h = 2166136261U;
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ (size_t)m[i]) * 16777619U;
+    return h % MARKS_HASH;
+}
+
+static size_t
+hashattrs(const TMTATTRS *a)
+{
+    size_t h = a->bold | a->dim << 1 | a->underline << 2 | a->blink << 3 |
+               a->reverse << 4 | a->invisible << 5;
+    const tmt_color_t *c[] = {&a->fg, &a->bg};
+    for (size_t i = 0; i < 2; i++){
+        h = h * 31 + (unsigned char)c[i]->code;
+        if (c[i]->code == TMT_COLOR_RGB)
+            h = h * 31 + ((size_t)c[i]->red << 16 | c[i]->green << 8 | c[i]->blue);
+    }
+    return (h ^ h >> 8) % STYLES_HASH;
+}
+
+static void
+sweep(TMT *vt)
+{
+    /* Cells are copied around by value, so a mark or style entry is
+     * garbage once no cell on any screen names it. Drop those, pack
+     * the survivors (in order, so each one only ever moves down), and
+     * rehash. Style 0 is the default rendition and always stays put.
+     */
+    TMTSCREEN alt = {vt->altring? vt->screen.nline : 0, vt->screen.ncol,
+                     vt->altring? vt->altring + vt->alttop : NULL};
+    TMTSCREEN *ss[] = {&vt->screen, &vt->scroll, &alt};
+    unsigned short *mmap = calloc(vt->nmarks, sizeof(unsigned short));
+    unsigned short *smap = calloc(vt->nstyles, sizeof(unsigned short));
+    if (!mmap || !smap){
+        free(mmap);
+        free(smap);
+        return;
+    }
+
+    smap[vt->style] = 1;
+    for (size_t k = 0; k < 3; k++)
+        for (size_t r = 0; r < ss[k]->nline; r++)
+            for (size_t i = 0; i < ss[k]->ncol; i++){
+                const TMTCHAR *ch = &ss[k]->lines[r]->chars[i];
+                mmap[ch->marks] = smap[ch->style] = 1;
+            }
+
+    size_t n = 1, nb = 0;
+    memset(vt->markhash, 0, sizeof(vt->markhash));
+    for (size_t i = 1; i < vt->nmarks; i++) if (mmap[i]){
+        MARKS *m = &vt->marks[n];
+        *m = vt->marks[i];
+        memmove(vt->markbuf + nb, vt->markbuf + m->off, m->n * sizeof(tmt_wchar_t));
+        m->off = nb;
+        nb += m->n;
+
+        size_t h = hashmarks(vt->markbuf + m->off, m->n);
+        m->next = vt->markhash[h];
+        vt->markhash[h] = (unsigned short)n;
+        mmap[i] = (unsigned short)n++;
+    }
+    mmap[0] = 0;
+    vt->nmarks = n;
+    vt->nmarkbuf = nb;
+    vt->msweep = MIN(MAX(MARKS_SWEEP, n * 2), MARKS_MAX);
+
+    n = 1;
+    memset(vt->stylehash, 0, sizeof(vt->stylehash));
+    for (size_t i = 1; i < vt->nstyles; i++) if (smap[i]){
+        STYLE *t = &vt->styles[n];
+        *t = vt->styles[i];
+
+        size_t h = hashattrs(&t->a);
+        t->next = vt->stylehash[h];
+        vt->stylehash[h] = (unsigned short)n;
+        smap[i] = (unsigned short)n++;
+    }
+    smap[0] = 0;
+    vt->nstyles = n;
+    vt->ssweep = MIN(MAX(STYLES_SWEEP, n * 2), STYLES_MAX);
+
+    /* A screen line whose numbers changed is dirty, for the sake of
+     * programs that keep copies of the cells.
+     */
+    for (size_t k = 0; k < 3; k++)
+        for (size_t r = 0; r < ss[k]->nline; r++){
+            TMTLINE *l = ss[k]->lines[r];
+            for (size_t i = 0; i < ss[k]->ncol; i++){
+                TMTCHAR *ch = &l->chars[i];
+                if (k == 0 && (ch->marks != mmap[ch->marks] ||
+                               ch->style != smap[ch->style]))
+                    damage(vt, r, i, i + 1);
+                ch->marks = mmap[ch->marks];
+                ch->style = smap[ch->style];
+            }
+        }
+    /* Copies of what the program has use the old numbers. */
+    for (size_t r = 0; r < vt->screen.nline; r++)
+        vt->shown[r].known = false;
+    vt->style = smap[vt->style];
+    vt->hlogrec = SIZE_MAX;
+    free(mmap);
+    free(smap);
+}
+
+static bool
+growmarks(TMT *vt, size_t n)
+{
+    if (vt->nmarks >= vt->szmarks){
+        size_t sz = MAX(vt->szmarks * 2, 64);
+        MARKS *m = realloc(vt->marks, sz * sizeof(MARKS));
+        if (!m) return false;
+        vt->marks = m;
+        vt->szmarks = sz;
+    }
+    if (vt->nmarkbuf + n > vt->szmarkbuf){
+        size_t sz = MAX(vt->szmarkbuf * 2, vt->nmarkbuf + n);
+        tmt_wchar_t *b = realloc(vt->markbuf, sz * sizeof(tmt_wchar_t));
+        if (!b) return false;
+        vt->markbuf = b;
+        vt->szmarkbuf = sz;
+    }
+    return true;
+}
+
+static unsigned short
+internmarks(TMT *vt, const tmt_wchar_t *m, size_t n)
+{
+    /* Mark sequences are interned in vt->marks, and a cell refers to its
+     * sequence by index, so equal sequences are stored once and can be
+     * shared freely. Entry 0 is never used: a zero index means "no marks",
+     * which is also what comes back if the table is full.
+     */
+    size_t h = hashmarks(m, n);
+    for (size_t i = vt->markhash[h]; i; i = vt->marks[i].next){
+        if (vt->marks[i].n == n &&
+            memcmp(vt->markbuf + vt->marks[i].off, m, n * sizeof(tmt_wchar_t)) == 0)
+            return (unsigned short)i;
+    }
+
+    if (vt->nmarks == MARKS_MAX || !growmarks(vt, n)) return 0;
+    MARKS *e = &vt->marks[vt->nmarks];
+    e->off = vt->nmarkbuf;
+    e->n = (unsigned short)n;
+    e->next = vt->markhash[h];
+    memcpy(vt->markbuf + e->off, m, n * sizeof(tmt_wchar_t));
+    vt->nmarkbuf += n;
+    vt->markhash[h] = (unsigned short)vt->nmarks;
+    return (unsigned short)vt->nmarks++;
+}
+
+static void
+addmark(TMT *vt, TMTCHAR *ch, tmt_wchar_t w)
+{
+    tmt_wchar_t m[MAX_TMTCHAR_MARKS];
+    size_t n = 0;
+
+    if (vt->nmarks >= vt->msweep) sweep(vt);
+
+    if (ch->marks){
+        const MARKS *o = &vt->marks[ch->marks];
+        n = o->n;
+        memcpy(m, vt->markbuf + o->off, n * sizeof(tmt_wchar_t));
+    }
+    if (n == MAX_TMTCHAR_MARKS) return;
+    m[n++] = w;
+
+    unsigned short i = internmarks(vt, m, n);
+    if (i) ch->marks = i;
+}
+
+static unsigned short
+internattrs(TMT *vt, const TMTATTRS *a)
+{
+    /* Renditions are interned the same way as marks: equal indexes mean
+     * equal renditions. If the table can't take another entry, fall back
+     * to the default rendition rather than fail.
+     */
+    if (sameattrs(a, &defattrs)) return 0;
+
+    size_t h = hashattrs(a);
+    for (size_t i = vt->stylehash[h]; i; i = vt->styles[i].next){
+        if (sameattrs(&vt->styles[i].a, a))
+            return (unsigned short)i;
+    }
+
+    if (vt->nstyles == STYLES_MAX) return 0;
+    if (vt->nstyles == vt->szstyles){
+        size_t sz = vt->szstyles * 2;
+        STYLE *t = realloc(vt->styles, sz * sizeof(STYLE));
+        if (!t) return 0;
+        vt->styles = t;
+        vt->szstyles = sz;
+    }
+    vt->styles[vt->nstyles].a = *a;
+    vt->styles[vt->nstyles].next = vt->stylehash[h];
+    vt->stylehash[h] = (unsigned short)vt->nstyles;
+    return (unsigned short)vt->nstyles++;
+}
+
+static void
+setstyle(TMT *vt)
+{
+    vt->style = 0;
+    if (vt->nstyles >= vt->ssweep) sweep(vt);
+    vt->style = internattrs(vt, &vt->attrs);
+}
+
 #define ADD_MARK(w) { \
 	if (cur_char_type == TMT_IGNORED) { \
 		if (cur_col > 0) cur_col -= 1; \
 	} \
-	size_t *num_marks = &CLINE(vt)->chars[cur_col].num_marks;\
-	if (*num_marks < MAX_TMTCHAR_MARKS) { \
-		CLINE(vt)->chars[cur_col].marks[*num_marks] = w; \
-		*num_marks += 1; \
-	} \
+	damage(vt, CROW(vt), (size_t)cur_col, (size_t)cur_col + 1); \
+	addmark(vt, &CLINE(vt)->chars[cur_col], w); \
 }
 
 #define UPDATE_FULLWIDTH() {\
 	TMTCHAR mc;	\
-	memcpy(&mc, &CLINE(vt)->chars[vt->curs.c], sizeof(TMTCHAR)); \
+	memcpy(&mc, &CLINE(vt)->chars[MIN(vt->curs.c, s->ncol - 1)], sizeof(TMTCHAR)); \
 	mc.char_type = TMT_FULLWIDTH; \
 	if (c->c+1 >= s->ncol) { \
-		CLINE(vt)->chars[vt->curs.c].c = L' '; \
-		CLINE(vt)->chars[vt->curs.c].a = vt->attrs; \
-		CLINE(vt)->chars[vt->curs.c].char_type = TMT_HALFWIDTH; \
-		CLINE(vt)->chars[vt->curs.c].num_marks = 0; \
-		CLINE(vt)->dirty = vt->dirty = true; \
+		if (c->c < s->ncol) { \
+			damage(vt, CROW(vt), vt->curs.c, vt->curs.c + 1); \
+			CLINE(vt)->chars[vt->curs.c].c = L' '; \
+			CLINE(vt)->chars[vt->curs.c].style = vt->style; \
+			CLINE(vt)->chars[vt->curs.c].char_type = TMT_HALFWIDTH; \
+			CLINE(vt)->chars[vt->curs.c].marks = 0; \
+		} \
+		CLINE(vt)->wrapped = true; \
 		c->c = 0; \
-		c->r++; \
-	} \
-	if (c->r >= s->nline){ \
-		c->r = s->nline - 1; \
-		scrup(vt, 0, 1); \
+		linefeed(vt); \
 	} \
+	damage(vt, CROW(vt), vt->curs.c, vt->curs.c + 2); \
 	memcpy(&CLINE(vt)->chars[vt->curs.c], &mc, sizeof(TMTCHAR)); \
 	CLINE(vt)->chars[vt->curs.c+1].c = L' '; \
-	CLINE(vt)->chars[vt->curs.c+1].a = vt->attrs; \
+	CLINE(vt)->chars[vt->curs.c+1].style = vt->style; \
 	CLINE(vt)->chars[vt->curs.c+1].char_type = TMT_IGNORED; \
-	CLINE(vt)->chars[vt->curs.c+1].num_marks = 0; \
+	CLINE(vt)->chars[vt->curs.c+1].marks = 0; \
 	c->c += 2; \
 }
 
@@ -544,6 +1337,7 @@ tmt_resize(TMT *vt, size_t nline, size_t ncol)
 		if (cur_char_type == TMT_IGNORED) { \
 			if (cur_col > 0) cur_col -= 1; \
 		} \
+		damage(vt, CROW(vt), (size_t)cur_col, (size_t)cur_col + 1); \
 		CLINE(vt)->chars[cur_col].char_type = new_char_type; \
 	} \
 }
@@ -563,10 +1357,10 @@ writecharatcurs(TMT *vt, tmt_wchar_t w)
 	int cur_col = vt->curs.c;
 	if (vt->curs.c > 0) cur_col -= 1;
 	cur_char_type = CLINE(vt)->chars[cur_col].char_type;
-	bool full_width = is_wc_unicode_full_width(w, false);
+	unsigned char props = get_wc_unicode_props(w);
+	bool full_width = props & WIDE_PROP_WIDE;
 	tmt_char_t new_char_type = full_width ? TMT_FULLWIDTH : TMT_HALFWIDTH;
-	tmt_mark_t mark_type = get_wc_unicode_mark_type(w);
-	switch (mark_type) {
+	switch (WIDE_PROP_MARK(props)) {
 		case TMT_NOT_MARK:
 			break;
 		case TMT_FORMAT:
@@ -574,13 +1368,11 @@ writecharatcurs(TMT *vt, tmt_wchar_t w)
 			break;
 		case TMT_MARK:
 			ADD_MARK(w);
-			CLINE(vt)->dirty = vt->dirty = true;
 			return;
 		case TMT_MARK_FULLWIDTH:
 		{
 			ADD_MARK(w);
 			MAKE_FULLWIDTH();
-			CLINE(vt)->dirty = vt->dirty = true;
 			return;
 		}
 	}
@@ -588,7 +1380,6 @@ writecharatcurs(TMT *vt, tmt_wchar_t w)
 	if (cur_char_type == TMT_FORMATTER) {
 		ADD_MARK(w);
 		REPLACE_CHARTYPE();
-		CLINE(vt)->dirty = vt->dirty = true;
 		return;
 	}
 
@@ -596,23 +1387,29 @@ writecharatcurs(TMT *vt, tmt_wchar_t w)
 
 	/* If at end of screen, wrap to next line */
 	if (c->c+use_cols-1 >= s->ncol) {
+		CLINE(vt)->wrapped = true;
 		c->c = 0;
-		c->r++;
+		linefeed(vt);
 	}
-    if (c->r >= s->nline){
-        c->r = s->nline - 1;
-        scrup(vt, 0, 1);
-    }
 
-    CLINE(vt)->chars[vt->curs.c].c = w;
-    CLINE(vt)->chars[vt->curs.c].a = vt->attrs;
-    CLINE(vt)->chars[vt->curs.c].char_type = new_char_type;
+    /* Nothing to dirty if the cell already holds this character. */
+    l = CLINE(vt);
+    if (!l->dirty && SAMECHAR(&l->chars[c->c], w, vt->style, new_char_type) &&
+        (!full_width || SAMECHAR(&l->chars[c->c+1], L' ', vt->style, TMT_IGNORED))){
+        c->c += use_cols;
+        return;
+    }
+    damage(vt, CROW(vt), c->c, c->c + use_cols);
+    l->chars[c->c].c = w;
+    l->chars[c->c].style = vt->style;
+    l->chars[c->c].char_type = new_char_type;
+    l->chars[c->c].marks = 0;
 	if (full_width) {
-		CLINE(vt)->chars[vt->curs.c+1].c = L' ';
-		CLINE(vt)->chars[vt->curs.c+1].a = vt->attrs;
-		CLINE(vt)->chars[vt->curs.c+1].char_type = TMT_IGNORED;
+		l->chars[c->c+1].c = L' ';
+		l->chars[c->c+1].style = vt->style;
+		l->chars[c->c+1].char_type = TMT_IGNORED;
+		l->chars[c->c+1].marks = 0;
 	}
-    CLINE(vt)->dirty = vt->dirty = true;
 
 	/* Advance cursor to next column 
 	   Will wrap if necessary when trying to write next character. */
@@ -620,31 +1417,117 @@ writecharatcurs(TMT *vt, tmt_wchar_t w)
 
 }
 
-static inline size_t
-testmbchar(TMT *vt)
+#define ISTEXT(b) ((unsigned char)(b) >= 0x20 && (unsigned char)(b) < 0x7f)
+
+static size_t
+writetext(TMT *vt, const char *s, size_t n)
 {
-#ifdef FORCE_UTF8
-    struct utf8_state us = vt->us;
-	return vt->nmb ? utf8_to_wc(NULL, vt->mb, vt->nmb, &us) : UTF8_INCOMPLETE;
-#else
-    mbstate_t ts = vt->ms;
-    return vt->nmb? mbrtowc(NULL, vt->mb, vt->nmb, &ts) : (size_t)-2;
-#endif
+    /* Fast path for a run of printable ASCII in ground state: these
+     * bytes can't start a sequence, never need decoding, and always
+     * occupy exactly one column, so store as many as fit on the
+     * current line in one go.
+     */
+    TMTPOINT *c = &vt->curs;
+    size_t p = 0;
+
+    endsequence(vt);
+
+    while (p < n && ISTEXT(s[p])){
+        if (c->c >= vt->screen.ncol ||
+            CLINE(vt)->chars[c->c? c->c - 1 : 0].char_type == TMT_FORMATTER){
+            writecharatcurs(vt, (unsigned char)s[p++]);
+            continue;
+        }
+
+        size_t e = p + scan_text(s + p, MIN(n - p, vt->screen.ncol - c->c));
+
+        /* Compare the whole run first, so a clean line only takes damage
+         * from the first to the last cell that changes.
+         */
+        TMTLINE *l = CLINE(vt);
+        TMTCHAR *t = l->chars + c->c;
+        size_t lo = 0, hi = e - p;
+        if (!l->dirty){
+            while (lo < hi && SAMECHAR(&t[lo], (unsigned char)s[p + lo], vt->style, TMT_HALFWIDTH))
+                lo++;
+            while (hi > lo && SAMECHAR(&t[hi - 1], (unsigned char)s[p + hi - 1], vt->style, TMT_HALFWIDTH))
+                hi--;
+        }
+        damage(vt, CROW(vt), c->c + lo, c->c + hi);
+        for (size_t i = lo; i < hi; i++){
+            t[i].c = (unsigned char)s[p + i];
+            t[i].style = vt->style;
+            t[i].char_type = TMT_HALFWIDTH;
+            t[i].marks = 0;
+        }
+        c->c += e - p;
+        p = e;
+    }
+    return p;
 }
 
-static inline tmt_wchar_t
-getmbchar(TMT *vt)
-{
-    tmt_wchar_t c = 0;
 #ifdef FORCE_UTF8
-	int cnt = utf8_to_wc(&c, vt->mb, vt->nmb, &vt->us);
-	vt->nmb = 0;
-	return (cnt < 0) ? TMT_INVALID_CHAR : c;
+#define MBPENDING(vt) ((vt)->us.pos)
+
+static void
+writemb(TMT *vt, const char *s, size_t n)
+{
+    tmt_wchar_t w[64];
+
+    while (n){
+        size_t used = 0;
+        size_t k = utf8_to_wc_n(w, sizeof(w) / sizeof(w[0]), s, n, &vt->us, &used);
+        for (size_t i = 0; i < k; i++)
+            writecharatcurs(vt, w[i]);
+        s += used;
+        n -= used;
+    }
+}
 #else
-    size_t n = mbrtowc(&c, vt->mb, vt->nmb, &vt->ms);
-    vt->nmb = 0;
-    return (n == (size_t)-1 || n == (size_t)-2)? TMT_INVALID_CHAR : c;
+#define MBPENDING(vt) (!mbsinit(&(vt)->ms))
+
+static void
+writemb(TMT *vt, const char *s, size_t n)
+{
+    /* mbrtowc() keeps a partial character in vt->ms, so every byte is
+     * handed over exactly once, even when a character spans calls.
+     */
+    while (n){
+        tmt_wchar_t w = 0;
+        bool pending = MBPENDING(vt);
+        size_t r = mbrtowc(&w, s, n, &vt->ms);
+
+        if (r == (size_t)-2)
+            return;
+        if (r == (size_t)-1){
+            /* If a character was already in progress, the byte that broke
+             * it off gets a second look with a clean state. */
+            memset(&vt->ms, 0, sizeof(vt->ms));
+            w = TMT_INVALID_CHAR;
+            r = pending? 0 : 1;
+        } else if (r == 0)
+            r = 1;
+
+        writecharatcurs(vt, w);
+        s += r;
+        n -= r;
+    }
+}
 #endif
+
+static size_t
+writespan(TMT *vt, const char *s, size_t n)
+{
+    /* Everything up to the next C0 control is text in ground state, so
+     * decode it as one span.
+     */
+    size_t e = 0;
+    while (e < n && (unsigned char)s[e] >= 0x20)
+        e++;
+
+    endsequence(vt);
+    writemb(vt, s, e);
+    return e;
 }
 
 void
@@ -654,23 +1537,20 @@ tmt_write(TMT *vt, const char *s, size_t n)
     n = n? n : strlen(s);
 
     for (size_t p = 0; p < n; p++){
-        if (handlechar(vt, s[p]))
+        if (vt->state == S_NUL && !vt->acs && !MBPENDING(vt) && ISTEXT(s[p]))
+            p += writetext(vt, s + p, n - p) - 1;
+        else if (vt->state == S_NUL && !vt->acs && (unsigned char)s[p] >= 0x20)
+            p += writespan(vt, s + p, n - p) - 1;
+        else if (handlechar(vt, s[p]))
             continue;
         else if (vt->acs)
             writecharatcurs(vt, tacs(vt, (unsigned char)s[p]));
-        else if (vt->nmb >= BUF_MAX)
-            writecharatcurs(vt, getmbchar(vt));
-        else{
-            switch (testmbchar(vt)){
-                case (size_t)-1: writecharatcurs(vt, getmbchar(vt)); break;
-                case (size_t)-2: vt->mb[vt->nmb++] = s[p];           break;
-            }
-
-            if (testmbchar(vt) <= MB_LEN_MAX)
-                writecharatcurs(vt, getmbchar(vt));
-        }
+        else
+            writemb(vt, s + p, 1);
     }
 
+    flushscroll(vt);
+    settle(vt);
     notify(vt, vt->dirty, memcmp(&oc, &vt->curs, sizeof(oc)) != 0);
 }
 
@@ -686,18 +1566,654 @@ tmt_cursor(const TMT *vt)
     return &vt->curs;
 }
 
+static bool
+growhmap(TMT *vt, size_t n)
+{
+    /* vt->hmap is all zeros between uses. */
+    if (n > vt->szhmap){
+        unsigned short *m = realloc(vt->hmap, n * sizeof(unsigned short));
+        if (!m) return false;
+        memset(m + vt->szhmap, 0, (n - vt->szhmap) * sizeof(unsigned short));
+        vt->hmap = m;
+        vt->szhmap = n;
+    }
+    return true;
+}
+
+static unsigned char *
+putvar(unsigned char *p, size_t v)
+{
+    for (; v >= 0x80; v >>= 7)
+        *p++ = (unsigned char)(v | 0x80);
+    *p++ = (unsigned char)v;
+    return p;
+}
+
+static size_t
+getvar(const unsigned char **p)
+{
+    size_t v = 0;
+    for (unsigned s = 0; ; s += 7){
+        unsigned char b = *(*p)++;
+        v |= (size_t)(b & 0x7f) << s;
+        if (!(b & 0x80)) return v;
+    }
+}
+
+static unsigned char *
+putcolor(unsigned char *p, const tmt_color_t *c)
+{
+    *p++ = (unsigned char)c->code;
+    *p++ = c->red;
+    *p++ = c->green;
+    *p++ = c->blue;
+    return p;
+}
+
+static void
+getcolor(const unsigned char **p, tmt_color_t *c)
+{
+    c->code = (signed char)*(*p)++;
+    c->red = *(*p)++;
+    c->green = *(*p)++;
+    c->blue = *(*p)++;
+}
+
+enum {RUN_STYLE, RUN_TYPE, RUN_MARKS};
+
+static unsigned char *
+putruns(TMT *vt, unsigned char *p, const TMTLINE *l, size_t n, int what)
+{
+    /* A run-length list of one field of the cells: (length, value) pairs
+     * that add up to n. Styles and marks are given as record numbers.
+     */
+    unsigned short *smap = vt->hmap, *mmap = vt->hmap + vt->nstyles;
+    for (size_t i = 0, j; i < n; i = j){
+        size_t v = 0;
+        for (j = i; j < n; j++){
+            const TMTCHAR *ch = &l->chars[j];
+            size_t w = what == RUN_STYLE? smap[ch->style] :
+                       what == RUN_TYPE?  ch->char_type : mmap[ch->marks];
+            if (j == i) v = w;
+            else if (w != v) break;
+        }
+        p = putvar(putvar(p, j - i), v);
+    }
+    return p;
+}
+
+static void
+getruns(const unsigned char **p, TMTCHAR *l, size_t n, int what,
+        const unsigned short *map)
+{
+    for (size_t i = 0; i < n; ){
+        size_t len = getvar(p), v = getvar(p);
+        for (size_t e = MIN(i + len, n); i < e; i++){
+            switch (what){
+                case RUN_STYLE: l[i].style = map[v];                  break;
+                case RUN_TYPE:  l[i].char_type = (unsigned char)v;    break;
+                case RUN_MARKS: l[i].marks = map[v];                  break;
+            }
+        }
+    }
+}
+
+/* Scrollback records have to stand on their own, because style and mark
+ * numbers change whenever the tables are swept, and most of a line is
+ * usually blank, so records are packed hard. All numbers are varints:
+ *
+ *     ncol, the number of cells up to the last non-blank one (used),
+ *     and the number of styles and mark sequences the line uses
+ *     each style: flags, then code, red, green and blue of fg and bg
+ *     each mark sequence: its length, then the marks
+ *     run lists for the style, char_type and marks of the used cells,
+ *     with styles and marks numbered from 1 in the order given above
+ *     the characters, each as c + 1, or 0, a count and c + 1 for a run
+ *
+ * Cells past the used ones are blanks in the default rendition.
+ */
+static void
+pushhistory(TMT *vt, const TMTLINE *l)
+{
+    size_t ncol = vt->screen.ncol, used = ncol, ns = 0, nm = 0, nw = 0;
+    if (!growhmap(vt, vt->nstyles + vt->nmarks)) return;
+    unsigned short *smap = vt->hmap, *mmap = vt->hmap + vt->nstyles;
+
+    while (used && BLANK(&l->chars[used - 1]))
+        used--;
+    for (size_t i = 0; i < used; i++){
+        const TMTCHAR *ch = &l->chars[i];
+        if (ch->style && !smap[ch->style])
+            smap[ch->style] = (unsigned short)++ns;
+        if (ch->marks && !mmap[ch->marks]){
+            mmap[ch->marks] = (unsigned short)++nm;
+            nw += vt->marks[ch->marks].n;
+        }
+    }
+
+    size_t max = 40 + ns * 9 + (nm + nw) * 5 + used * 40;
+    if (max > vt->szhbuf){
+        unsigned char *b = realloc(vt->hbuf, max);
+        if (b){
+            vt->hbuf = b;
+            vt->szhbuf = max;
+        }
+    }
+
+    if (max <= vt->szhbuf){
+        unsigned char *p = vt->hbuf;
+        p = putvar(putvar(putvar(putvar(p, ncol), used * 2 + l->wrapped), ns), nm);
+        for (size_t i = 0, k = 0; i < used; i++){
+            const TMTCHAR *ch = &l->chars[i];
+            if (ch->style && smap[ch->style] > k){
+                const TMTATTRS *a = &vt->styles[ch->style].a;
+                *p++ = (unsigned char)(a->bold | a->dim << 1 | a->underline << 2 |
+                                       a->blink << 3 | a->reverse << 4 | a->invisible << 5);
+                p = putcolor(putcolor(p, &a->fg), &a->bg);
+                k++;
+            }
+        }
+        for (size_t i = 0, k = 0; i < used; i++){
+            const TMTCHAR *ch = &l->chars[i];
+            if (ch->marks && mmap[ch->marks] > k){
+                const MARKS *m = &vt->marks[ch->marks];
+                p = putvar(p, m->n);
+                for (size_t j = 0; j < m->n; j++)
+                    p = putvar(p, vt->markbuf[m->off + j]);
+                k++;
+            }
+        }
+        p = putruns(vt, p, l, used, RUN_STYLE);
+        p = putruns(vt, p, l, used, RUN_TYPE);
+        p = putruns(vt, p, l, used, RUN_MARKS);
+        for (size_t i = 0, j; i < used; i = j){
+            tmt_wchar_t c = l->chars[i].c;
+            for (j = i + 1; j < used && l->chars[j].c == c; j++)
+                ;
+            if (j - i >= 3)
+                p = putvar(putvar(p, 0), j - i);
+            else
+                j = i + 1;
+            p = putvar(p, (size_t)c + 1);
+        }
+        if (history_push(&vt->hist, vt->hbuf, (size_t)(p - vt->hbuf)))
+            vt->hpushed++;
+    }
+
+    for (size_t i = 0; i < used; i++)
+        smap[l->chars[i].style] = mmap[l->chars[i].marks] = 0;
+}
+
+static void
+forgetrows(TMT *vt)
+{
+    vt->hfirst = vt->nhrows = 0;
+    vt->hfront = vt->hend = vt->hpushed;
+}
+
+void
+tmt_history_limit(TMT *vt, size_t maxlines, size_t maxbytes)
+{
+    if (maxlines || maxbytes)
+        history_limit(&vt->hist, maxlines, maxbytes);
+    else
+        history_free(&vt->hist);
+    forgetrows(vt);
+}
+
+void
+tmt_report_shifts(TMT *vt, bool report)
+{
+    vt->shifts = report;
+}
+
+bool
+tmt_history_spill(TMT *vt, const char *path)
+{
+    return history_spill(&vt->hist, path);
+}
+
+size_t
+tmt_history_size(const TMT *vt)
+{
+    return vt->hist.count;
+}
+
+static TMTCHAR *
+readhistory(TMT *vt, size_t n, size_t *ncol, size_t *nused, bool *wrapped)
+{
+    /* Turn the record's own style and mark numbers back into the
+     * terminal's, interning them as needed. Nothing here sweeps the
+     * tables, so the numbers stay good until the next tmt_write().
+     */
+    size_t len;
+    const unsigned char *p = history_get(&vt->hist, n, &len);
+    if (!p) return NULL;
+    size_t nc = getvar(&p), used = getvar(&p), ns = getvar(&p), nm = getvar(&p);
+    *wrapped = used & 1;
+    used >>= 1;
+
+    if (nc > vt->szhline){
+        TMTCHAR *l = realloc(vt->hline, nc * sizeof(TMTCHAR));
+        if (!l) return NULL;
+        vt->hline = l;
+        vt->szhline = nc;
+    }
+    if (!growhmap(vt, ns + nm + 2)) return NULL;
+    unsigned short *smap = vt->hmap, *mmap = vt->hmap + ns + 1;
+
+    for (size_t i = 1; i <= ns; i++){
+        TMTATTRS a = defattrs;
+        unsigned char f = *p++;
+        a.bold = f & 1;
+        a.dim = f >> 1 & 1;
+        a.underline = f >> 2 & 1;
+        a.blink = f >> 3 & 1;
+        a.reverse = f >> 4 & 1;
+        a.invisible = f >> 5 & 1;
+        getcolor(&p, &a.fg);
+        getcolor(&p, &a.bg);
+        smap[i] = internattrs(vt, &a);
+    }
+    for (size_t i = 1; i <= nm; i++){
+        tmt_wchar_t m[MAX_TMTCHAR_MARKS];
+        size_t k = getvar(&p);
+        for (size_t j = 0; j < k; j++){
+            tmt_wchar_t w = (tmt_wchar_t)getvar(&p);
+            if (j < MAX_TMTCHAR_MARKS) m[j] = w;
+        }
+        mmap[i] = internmarks(vt, m, MIN(k, MAX_TMTCHAR_MARKS));
+    }
+
+    TMTCHAR *l = vt->hline;
+    getruns(&p, l, used, RUN_STYLE, smap);
+    getruns(&p, l, used, RUN_TYPE, NULL);
+    getruns(&p, l, used, RUN_MARKS, mmap);
+    for (size_t i = 0; i < used; ){
+        size_t k = 1, c = getvar(&p);
+        if (!c){
+            k = getvar(&p);
+            c = getvar(&p);
+        }
+        for (size_t e = MIN(i + k, used); i < e; i++)
+            l[i].c = (tmt_wchar_t)(c - 1);
+    }
+    for (size_t i = used; i < nc; i++){
+        l[i].c = L' ';
+        l[i].style = l[i].marks = 0;
+        l[i].char_type = TMT_HALFWIDTH;
+    }
+    memset(vt->hmap, 0, (ns + nm + 2) * sizeof(unsigned short));
+
+    *ncol = nc;
+    *nused = used;
+    return l;
+}
+
+const TMTCHAR *
+tmt_history_line(TMT *vt, size_t n, size_t *ncol)
+{
+    size_t used;
+    bool wrapped;
+    return readhistory(vt, n, ncol, &used, &wrapped);
+}
+
+static bool
+histwrapped(TMT *vt, size_t n)
+{
+    size_t len;
+    const unsigned char *p = history_get(&vt->hist, n, &len);
+    if (!p) return false;
+    getvar(&p);
+    return getvar(&p) & 1;
+}
+
+/**** REFLOW */
+static size_t
+usedcells(const TMTLINE *l, size_t ncol)
+{
+    while (ncol && BLANK(&l->chars[ncol - 1]))
+        ncol--;
+    return ncol;
+}
+
+static bool
+joincells(TMT *vt, size_t *len, const TMTCHAR *c, size_t n, bool cont,
+          size_t *at)
+{
+    /* Append n cells to vt->hlog. A wide character that didn't fit at
+     * the end of the row before left a blank there, which goes again.
+     */
+    if (cont && n && c[0].char_type == TMT_FULLWIDTH && *len){
+        const TMTCHAR *b = &vt->hlog[*len - 1];
+        if (b->c == L' ' && !b->marks && b->char_type == TMT_HALFWIDTH)
+            (*len)--;
+    }
+    if (*len + n >= vt->szhlog){
+        size_t sz = MAX(*len + n + 1, vt->szhlog * 2);
+        TMTCHAR *h = realloc(vt->hlog, sz * sizeof(TMTCHAR));
+        size_t *b = realloc(vt->hbrk, (sz + 1) * sizeof(size_t));
+        if (h) vt->hlog = h;
+        if (b) vt->hbrk = b;
+        if (!h || !b) return false;
+        vt->szhlog = sz;
+    }
+    *at = *len;
+    if (n) memcpy(vt->hlog + *len, c, n * sizeof(TMTCHAR));
+    *len += n;
+    return true;
+}
+
+static size_t
+wrapcells(const TMTCHAR *c, size_t len, size_t w, size_t *brk)
+{
+    /* Break len cells into rows of w, never splitting a wide character;
+     * store where each row starts and return how many there are.
+     */
+    size_t n = 1, col = 0;
+    brk[0] = 0;
+    for (size_t i = 0; i < len; ){
+        size_t k = c[i].char_type == TMT_FULLWIDTH && i + 1 < len? 2 : 1;
+        if (col + k > w){
+            brk[n++] = i;
+            col = 0;
+        }
+        col += k;
+        i += k;
+    }
+    return n;
+}
+
+static bool
+reflow(TMT *vt, size_t onl, size_t pc, size_t nline, size_t ncol, bool curs)
+{
+    /* Join the screen's soft-wrapped rows back into logical lines and
+     * wrap those at the new width. What no longer fits above the cursor
+     * goes to history; blank rows at the bottom go away. Nothing old is
+     * touched until everything new has been allocated.
+     */
+    TMTLINE **old = vt->screen.lines, **out = NULL, **ring = NULL;
+    TMTPOINT *c = &vt->curs;
+    size_t nout = 0, szout = 0, cr = 0, cc = 0, last = curs? MIN(c->r, onl - 1) : 0;
+    bool ok = true;
+
+    vt->screen.ncol = ncol;
+    vt->hlogrec = SIZE_MAX; /* vt->hlog and vt->hbrk are scratch here */
+    for (size_t i = onl; i-- > last; )
+        if (usedcells(old[i], pc)){
+            last = i;
+            break;
+        }
+
+    for (size_t i = 0; ok && i <= last; i++){
+        size_t len = 0, at = 0, coff = SIZE_MAX, nr;
+        for (bool cont = true; ok && cont; i++){
+            cont = i < last && old[i]->wrapped;
+            size_t n = cont? pc : usedcells(old[i], pc);
+            if (curs && i == c->r)
+                n = MAX(n, MIN(c->c, pc));
+            ok = joincells(vt, &len, old[i]->chars, n, len != 0, &at);
+            if (curs && i == c->r)
+                coff = at + c->c;
+        }
+        i--;
+        if (!ok) break;
+
+        nr = wrapcells(vt->hlog, len, ncol, vt->hbrk);
+        if (nout + nr > szout){
+            TMTLINE **o = realloc(out, MAX(nout + nr, szout * 2) * sizeof(TMTLINE *));
+            if (!(ok = o != NULL)) break;
+            out = o;
+            szout = MAX(nout + nr, szout * 2);
+        }
+        for (size_t r = 0; r < nr; r++){
+            size_t s = vt->hbrk[r], e = r + 1 < nr? vt->hbrk[r + 1] : len;
+            TMTLINE *l = allocline(vt, NULL, ncol, 0);
+            if (!(ok = l != NULL)) break;
+            memcpy(l->chars, vt->hlog + s, (e - s) * sizeof(TMTCHAR));
+            l->wrapped = r + 1 < nr;
+            if (coff != SIZE_MAX && coff >= s && (coff < e || r + 1 == nr)){
+                cr = nout;
+                cc = coff - s;
+            }
+            out[nout++] = l;
+        }
+    }
+
+    size_t top = nout > nline? MIN(nout - nline, curs? cr : nout) : 0;
+    size_t keep = MIN(nout - top, nline);
+    if (ok && (ring = malloc(2 * nline * sizeof(TMTLINE *))))
+        for (size_t i = keep; i < nline; i++)
+            if (!(ring[i] = allocline(vt, NULL, ncol, 0))){
+                while (i-- > keep)
+                    free(ring[i]);
+                free(ring);
+                ring = NULL;
+                break;
+            }
+    if (!ring){
+        for (size_t i = 0; i < nout; i++)
+            free(out[i]);
+        free(out);
+        vt->screen.ncol = pc;
+        return false;
+    }
+
+    for (size_t i = 0; i < top; i++)
+        if (vt->hist.maxlines || vt->hist.maxbytes)
+            pushhistory(vt, out[i]);
+    for (size_t i = 0; i < nout; i++){
+        if (i >= top && i < top + keep)
+            ring[i - top] = out[i];
+        else
+            free(out[i]);
+    }
+    for (size_t i = 0; i < onl; i++)
+        free(old[i]);
+    free(vt->ring);
+    free(out);
+
+    vt->ring = vt->screen.lines = ring;
+    vt->top = 0;
+    vt->screen.nline = nline;
+    syncring(vt, 0, nline);
+    if (curs){
+        c->r = cr - top;
+        c->c = cc;
+    }
+    return true;
+}
+
+static size_t
+loadlogical(TMT *vt, size_t n, size_t *oldest)
+{
+    /* Load the logical line whose last row is history record n into
+     * vt->hlog and wrap it at the current width; return its row count.
+     */
+    size_t k = n, len = 0, at, nc, used;
+    bool wrapped;
+    while (k + 1 < vt->hist.count && histwrapped(vt, k + 1))
+        k++;
+    for (size_t j = k + 1; j-- > n; ){
+        TMTCHAR *l = readhistory(vt, j, &nc, &used, &wrapped);
+        if (!l || !joincells(vt, &len, l, j > n? nc : used, j < k, &at))
+            return 0;
+    }
+    if (!joincells(vt, &len, NULL, 0, false, &at)) return 0;
+    size_t nr = wrapcells(vt->hlog, len, vt->hwidth, vt->hbrk);
+    vt->hbrk[nr] = len;
+    vt->hlogrec = vt->hpushed - 1 - n;
+    *oldest = k;
+    return nr;
+}
+
+static bool
+hrowroom(TMT *vt, size_t front, size_t back)
+{
+    /* Make room for front more rows before the map and back more after. */
+    size_t n = vt->nhrows;
+    if (vt->hfirst >= front && vt->szhrows - vt->hfirst - n >= back)
+        return true;
+    size_t sz = vt->szhrows, need = n + front + back;
+    if (need > sz / 2){
+        HROW *h = realloc(vt->hrows, MAX(sz * 2, need) * sizeof(HROW));
+        if (!h) return false;
+        vt->hrows = h;
+        vt->szhrows = sz = MAX(sz * 2, need);
+    }
+    size_t at = front + (sz - need) / 2;
+    if (n) memmove(vt->hrows + at, vt->hrows + vt->hfirst, n * sizeof(HROW));
+    vt->hfirst = at;
+    return true;
+}
+
+static bool
+catchrows(TMT *vt)
+{
+    /* Take the lines trimmed since off the old end of the map, and add
+     * the lines pushed since to the new end.
+     */
+    size_t oldest = vt->hpushed - vt->hist.count, k, r;
+    HROW *h = vt->hrows + vt->hfirst;
+    if (vt->nhrows && vt->hend < oldest){
+        vt->hlogrec = SIZE_MAX;
+        while (vt->nhrows && h->rec < oldest){
+            h++;
+            vt->nhrows--;
+        }
+        /* The oldest line left may have lost its start. */
+        for (r = vt->nhrows? h->rec : 0; vt->nhrows && h->rec == r; h++)
+            vt->nhrows--;
+        vt->hfirst = (size_t)(h - vt->hrows);
+        vt->hend = r + 1;
+    }
+    if (vt->nhrows && vt->hfront < vt->hpushed &&
+        histwrapped(vt, vt->hpushed - vt->hfront)){
+        /* The newest line went on into the next record. */
+        for (r = vt->hfront - 1; vt->nhrows && h[vt->nhrows - 1].rec == r; )
+            vt->nhrows--;
+        vt->hfront = vt->nhrows? h[vt->nhrows - 1].rec + 1 : 0;
+    }
+    if (!vt->nhrows){
+        forgetrows(vt);
+        return true;
+    }
+
+    while (vt->hfront < vt->hpushed){
+        size_t t = vt->hfront, nr;
+        while (t + 1 < vt->hpushed && histwrapped(vt, vt->hpushed - 1 - t))
+            t++;
+        nr = loadlogical(vt, vt->hpushed - 1 - t, &k);
+        if (!nr || !hrowroom(vt, 0, nr)) return false;
+        for (r = 0; r < nr; r++)
+            vt->hrows[vt->hfirst + vt->nhrows++] = (HROW){t, r};
+        vt->hfront = t + 1;
+    }
+    return true;
+}
+
+const TMTCHAR *
+tmt_history_row(TMT *vt, size_t n, size_t *ncol)
+{
+    /* History is kept as it was written and only rewrapped here, as far
+     * back as has been asked for; a resize just starts this over.
+     */
+    size_t w = vt->screen.ncol, k;
+    if (vt->hwidth != w){
+        forgetrows(vt);
+        vt->hwidth = w;
+        vt->hlogrec = SIZE_MAX;
+    }
+    if (!catchrows(vt)) return NULL;
+
+    while (vt->nhrows <= n && vt->hend > vt->hpushed - vt->hist.count){
+        size_t nr = loadlogical(vt, vt->hpushed - vt->hend, &k);
+        if (!nr || !hrowroom(vt, nr, 0)) return NULL;
+        for (size_t r = nr; r--; vt->nhrows++)
+            vt->hrows[--vt->hfirst] = (HROW){vt->hend - 1, r};
+        vt->hend = vt->hpushed - 1 - k;
+    }
+    if (n >= vt->nhrows) return NULL;
+
+    HROW *h = &vt->hrows[vt->hfirst + vt->nhrows - 1 - n];
+    if (vt->hlogrec != h->rec &&
+        !loadlogical(vt, vt->hpushed - 1 - h->rec, &k)) return NULL;
+    if (w > vt->szhline){
+        TMTCHAR *l = realloc(vt->hline, w * sizeof(TMTCHAR));
+        if (!l) return NULL;
+        vt->hline = l;
+        vt->szhline = w;
+    }
+    size_t s = vt->hbrk[h->row], e = vt->hbrk[h->row + 1];
+    memcpy(vt->hline, vt->hlog + s, (e - s) * sizeof(TMTCHAR));
+    for (size_t i = e - s; i < w; i++){
+        vt->hline[i].c = L' ';
+        vt->hline[i].style = vt->hline[i].marks = 0;
+        vt->hline[i].char_type = TMT_HALFWIDTH;
+    }
+    *ncol = w;
+    return vt->hline;
+}
+
+const TMTATTRS *
+tmt_char_attrs(const TMT *vt, const TMTCHAR *ch)
+{
+    return ch->style < vt->nstyles? &vt->styles[ch->style].a : &defattrs;
+}
+
+size_t
+tmt_char_marks(const TMT *vt, const TMTCHAR *ch, const tmt_wchar_t **marks)
+{
+    if (!ch->marks || ch->marks >= vt->nmarks)
+        return *marks = NULL, 0;
+    *marks = vt->markbuf + vt->marks[ch->marks].off;
+    return vt->marks[ch->marks].n;
+}
+
+size_t
+tmt_next_dirty(const TMT *vt, size_t r)
+{
+    /* Rows from the top of the window to the end of the ring come
+     * first, then the ones that wrapped around to its start.
+     */
+    size_t nl = vt->screen.nline, t = vt->top, i;
+    if (r >= nl) return nl;
+    if (t + r < nl && (i = nextdirty(vt, t + r, nl)) < nl)
+        return i - t;
+    i = nextdirty(vt, t + r < nl? 0 : t + r - nl, t);
+    return i < t? i + nl - t : nl;
+}
+
+uint64_t
+tmt_generation(const TMT *vt)
+{
+    return vt->gen;
+}
+
+uint64_t
+tmt_line_generation(const TMT *vt, size_t r)
+{
+    uint64_t g = vt->screen.lines[r]->gen;
+    return g > vt->scrollgen? g : vt->scrollgen;
+}
+
 void
 tmt_clean(TMT *vt)
 {
-    for (size_t i = 0; i < vt->screen.nline; i++)
-        vt->dirty = vt->screen.lines[i]->dirty = false;
+    size_t nl = vt->screen.nline;
+    for (size_t i = nextdirty(vt, 0, nl); i < nl; i = nextdirty(vt, i + 1, nl)){
+        vt->shown[(i + nl - vt->top) % nl].known = false;
+        vt->ring[i]->dirty = false;
+    }
+    memset(vt->dmap, 0, (nl + 63) / 64 * sizeof(uint64_t));
+    vt->dirty = vt->alldirty = false;
 }
 
 void
 tmt_clean_scroll(TMT *vt)
 {
-    for (size_t i = 0; i < vt->scroll.nline; i++)
-        vt->scroll.lines[i]->dirty = false;
+    /* Scrolled lines are only reported once, from tmt_write(). */
+    (void)vt;
 }
 
 void
@@ -706,6 +2222,14 @@ tmt_reset(TMT *vt)
     vt->curs.r = vt->curs.c = vt->oldcurs.r = vt->oldcurs.c = vt->acs = (bool)0;
     resetparser(vt);
     vt->attrs = vt->oldattrs = defattrs;
+    vt->style = 0;
+    vt->mtop = 0;
+    vt->mbot = vt->screen.nline;
+    if (vt->alt){
+        swapscreens(vt);
+        vt->alt = false;
+        dirtylines(vt, 0, vt->screen.nline);
+    }
 #ifdef FORCE_UTF8
     memset(&vt->us, 0, sizeof(vt->us));
 #else
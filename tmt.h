@@ -30,8 +30,8 @@
 
 #include <stdbool.h>
 #include <stddef.h>
-#ifdef FORCE_UTF8
 #include <stdint.h>
+#ifdef FORCE_UTF8
 typedef uint32_t tmt_wchar_t;
 #else
 #include <wchar.h>
@@ -105,7 +105,7 @@ typedef enum {
 } tmt_char_t;
 
 typedef struct {
-	tmt_color_code_t code;
+	signed char code; /* a tmt_color_code_t */
 	unsigned char red;
 	unsigned char green;
 	unsigned char blue;
@@ -113,23 +113,24 @@ typedef struct {
 
 typedef struct TMTATTRS TMTATTRS;
 struct TMTATTRS{
-    bool bold;
-    bool dim;
-    bool underline;
-    bool blink;
-    bool reverse;
-    bool invisible;
+    bool bold: 1;
+    bool dim: 1;
+    bool underline: 1;
+    bool blink: 1;
+    bool reverse: 1;
+    bool invisible: 1;
     tmt_color_t fg;
     tmt_color_t bg;
 };
 
+/* Renditions and combining marks are kept out of line; see
+ * tmt_char_attrs() and tmt_char_marks(). */
 typedef struct TMTCHAR TMTCHAR;
 struct TMTCHAR{
     tmt_wchar_t c;
-    TMTATTRS    a;
-	tmt_char_t  char_type;
-	size_t      num_marks;
-	tmt_char_t  marks[MAX_TMTCHAR_MARKS];
+	unsigned short style;     /* same style, same rendition; 0 is default */
+	unsigned short marks;     /* 0 if the character has no marks */
+	unsigned char  char_type; /* a tmt_char_t */
 };
 
 typedef struct TMTPOINT TMTPOINT;
@@ -141,9 +142,20 @@ struct TMTPOINT{
 typedef struct TMTLINE TMTLINE;
 struct TMTLINE{
     bool dirty;
+    bool wrapped; /* text runs on into the next line */
+    size_t dmin, dmax; /* if dirty, columns dmin to dmax have changed */
+    uint64_t gen; /* generation of the last change; see tmt_line_generation */
     TMTCHAR chars[];
 };
 
+/* Rows top to bottom - 1 moved up by n rows, or down if n < 0. */
+typedef struct TMTSHIFT TMTSHIFT;
+struct TMTSHIFT{
+    size_t top;
+    size_t bottom;
+    ptrdiff_t n;
+};
+
 typedef struct TMTSCREEN TMTSCREEN;
 struct TMTSCREEN{
     size_t nline;
@@ -152,6 +164,19 @@ struct TMTSCREEN{
     TMTLINE **lines;
 };
 
+/* What a host terminal is showing, for tmt_render(). A zeroed one knows
+ * nothing, so the first rendering to it repaints everything. The cursor
+ * column is the screen width once the host has gone past the last one,
+ * and its row the screen height when there's no telling where it is.
+ */
+typedef struct TMTHOST TMTHOST;
+struct TMTHOST{
+    bool known;     /* false to assume nothing, not even the screen */
+    bool ech, rep;  /* the host understands ECH and REP             */
+    TMTPOINT curs;
+    TMTATTRS attrs;
+};
+
 /**** CALLBACK SUPPORT */
 typedef enum{
     TMT_MSG_MOVED,
@@ -159,7 +184,8 @@ typedef enum{
     TMT_MSG_ANSWER,
     TMT_MSG_BELL,
     TMT_MSG_CURSOR,
-    TMT_MSG_SCROLL
+    TMT_MSG_SCROLL,
+    TMT_MSG_SHIFT
 } tmt_msg_t;
 
 typedef void (*TMTCALLBACK)(tmt_msg_t m, struct TMT *v, const void *r, void *p);
@@ -172,8 +198,23 @@ bool tmt_resize(TMT *vt, size_t nline, size_t ncol);
 void tmt_write(TMT *vt, const char *s, size_t n);
 const TMTSCREEN *tmt_screen(const TMT *vt);
 const TMTPOINT *tmt_cursor(const TMT *vt);
+const TMTATTRS *tmt_char_attrs(const TMT *vt, const TMTCHAR *ch);
+size_t tmt_char_marks(const TMT *vt, const TMTCHAR *ch,
+                      const tmt_wchar_t **marks);
+void tmt_report_shifts(TMT *vt, bool report);
+void tmt_history_limit(TMT *vt, size_t maxlines, size_t maxbytes);
+bool tmt_history_spill(TMT *vt, const char *path);
+size_t tmt_history_size(const TMT *vt);
+const TMTCHAR *tmt_history_line(TMT *vt, size_t n, size_t *ncol);
+const TMTCHAR *tmt_history_row(TMT *vt, size_t n, size_t *ncol);
+size_t tmt_next_dirty(const TMT *vt, size_t r);
+uint64_t tmt_generation(const TMT *vt);
+uint64_t tmt_line_generation(const TMT *vt, size_t r);
+size_t tmt_render(const TMT *vt, TMTHOST *h, char *buf, size_t n);
+size_t tmt_render_shift(const TMT *vt, TMTHOST *h, const TMTSHIFT *sh,
+                        char *buf, size_t n);
 void tmt_clean(TMT *vt);
-void tmt_clean_scroll(TMT *vt);
+void tmt_clean_scroll(TMT *vt); /* does nothing, kept for compatibility */
 void tmt_reset(TMT *vt);
 
 #endif
@@ -0,0 +1,253 @@
+/* benchwrite - measure tmt_write() throughput.
+ *
+ * Usage: cc -O2 -I. -o benchwrite tools/benchwrite.c tmt.c wide_lookup.c \
+ *           byte_scan.c history.c render.c
+ *        ./benchwrite [-r rows] [-c cols] [-w write-size] [file...]
+ *
+ * Each corpus is fed to a fresh terminal in write-size pieces (4096 bytes
+ * by default) on a 60x200 screen, and the best of 5 runs is reported.
+ * Without file arguments four corpora are generated: an ASCII build log
+ * with occasional colours, escape-heavy input, mixed UTF-8 text, and
+ * CJK and emoji text.
+ *
+ * Unless FORCE_UTF8 is defined, input is decoded with mbrtowc() in the
+ * locale taken from the environment, so run it with a UTF-8 LC_ALL.
+ */
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "tmt.h"
+
+#define RUNS    5
+#define CORPUS  (4 << 20)
+
+struct corpus{
+    const char *name;
+    char *b;
+    size_t n;
+};
+
+static size_t nline = 60, ncol = 200, wsize = 4096;
+
+static double
+measure(const struct corpus *c)
+{
+    double best = 0.0;
+
+    for (int r = 0; r < RUNS; r++){
+        TMT *vt = tmt_open(nline, ncol, NULL, NULL, NULL);
+        if (!vt)
+            return 0.0;
+        clock_t t = clock();
+        for (size_t p = 0; p < c->n; p += wsize)
+            tmt_write(vt, c->b + p, c->n - p < wsize? c->n - p : wsize);
+        t = clock() - t;
+        tmt_close(vt);
+        if (r == 0 || (double)t < best)
+            best = (double)t;
+    }
+    return best / CLOCKS_PER_SEC;
+}
+
+/* A fixed generator, so every run sees the same corpora. */
+static unsigned long seed = 1;
+
+static unsigned
+rnd(unsigned n)
+{
+    seed = seed * 1103515245 + 12345;
+    return (unsigned)(seed >> 16) % n;
+}
+
+#define PICK(a) (a[rnd(sizeof(a) / sizeof(a[0]))])
+
+static size_t
+put(char *b, size_t n, const char *s)
+{
+    size_t l = strlen(s);
+    if (n + l > CORPUS)
+        return CORPUS;
+    memcpy(b + n, s, l);
+    return n + l;
+}
+
+static size_t
+buildlog(char *b)
+{
+    static const char *words[] ={
+        "cc", "-O2", "-c", "src/parse.c", "warning:", "error:", "note:",
+        "unused", "variable", "linking", "ok", "PASS", "x = 42;", "{", "}"
+    };
+    size_t n = 0;
+    while (n < CORPUS){
+        unsigned w = rnd(40), colour = rnd(10) == 0;
+        if (colour)
+            n = put(b, n, "\033[1;31m");
+        while (w--){
+            n = put(b, n, PICK(words));
+            n = put(b, n, " ");
+        }
+        if (colour)
+            n = put(b, n, "\033[0m");
+        n = put(b, n, rnd(20) == 0? "\ttab\r\n" : "\r\n");
+    }
+    return n;
+}
+
+static size_t
+escapes(char *b)
+{
+    static const char *seqs[] ={
+        "\033[%u;%uH", "\033[%uA", "\033[%uB", "\033[%uC", "\033[%uD",
+        "\033[%uJ", "\033[%uK", "\033[%uL", "\033[%uM", "\033[%uP",
+        "\033[%uX", "\033[%u@", "\033[%um", "\033[38;5;%um",
+        "\033[48;2;%u;%u;10m", "\0337", "\0338", "\033]0;title\007",
+        "\b", "\t", "\r\n"
+    };
+    char s[32];
+    size_t n = 0;
+    while (n < CORPUS){
+        if (rnd(2)){
+            snprintf(s, sizeof(s), PICK(seqs), rnd(60), rnd(200));
+            n = put(b, n, s);
+        } else{
+            unsigned l = 1 + rnd(12);
+            while (l-- && n < CORPUS)
+                b[n++] = (char)('a' + rnd(26));
+        }
+    }
+    return n;
+}
+
+static size_t
+utf8text(char *b)
+{
+    static const char *chars[] ={
+        "a", "b", "e", "t", " ", " ", "\xc3\xa9", "e\xcc\x81",
+        "\xce\xa9", "\xd0\x96", "\xe4\xb8\xad", "\xed\x95\x9c",
+        "\xf0\x9f\x98\x80", "\xe0\xb8\x81\xe0\xb8\xb4"
+    };
+    size_t n = 0;
+    while (n < CORPUS){
+        unsigned l = rnd(80);
+        while (l--)
+            n = put(b, n, PICK(chars));
+        n = put(b, n, "\r\n");
+    }
+    return n;
+}
+
+static size_t
+cjktext(char *b)
+{
+    static const char *chars[] ={
+        "\xe4\xb8\xad", "\xe6\x96\x87", "\xe5\xad\x97", "\xed\x95\x9c",
+        "\xea\xb0\x80", "\xe3\x81\x82", "\xef\xbd\xb1", "\xf0\x9f\x98\x80",
+        "\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd", "\xe2\x9d\xa4\xef\xb8\x8f"
+    };
+    size_t n = 0;
+    while (n < CORPUS){
+        unsigned l = rnd(60);
+        while (l--)
+            n = put(b, n, PICK(chars));
+        n = put(b, n, "\r\n");
+    }
+    return n;
+}
+
+static int
+slurp(struct corpus *c, const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    size_t cap = 0;
+
+    c->name = path;
+    c->b = NULL;
+    c->n = 0;
+    if (!f)
+        return 0;
+    for (;;){
+        if (c->n == cap){
+            char *b = realloc(c->b, cap = cap? cap * 2 : 65536);
+            if (!b)
+                break;
+            c->b = b;
+        }
+        size_t r = fread(c->b + c->n, 1, cap - c->n, f);
+        if (!r)
+            break;
+        c->n += r;
+    }
+    fclose(f);
+    return c->n > 0;
+}
+
+static void
+report(const struct corpus *c)
+{
+    double t = measure(c);
+    printf("%-16s %10.1f MB/s %8.1f ns/byte\n", c->name,
+           t > 0.0? c->n / t / 1e6 : 0.0, t * 1e9 / c->n);
+}
+
+static int
+usage(void)
+{
+    fprintf(stderr, "usage: benchwrite [-r rows] [-c cols] [-w write-size] "
+                    "[file...]\n");
+    return EXIT_FAILURE;
+}
+
+int
+main(int argc, char **argv)
+{
+    int i = 1;
+
+    setlocale(LC_ALL, "");
+    for (; i < argc && argv[i][0] == '-'; i++){
+        size_t *opt = argv[i][1] == 'r'? &nline :
+                      argv[i][1] == 'c'? &ncol :
+                      argv[i][1] == 'w'? &wsize : NULL;
+        if (!opt || argv[i][2] || i + 1 == argc)
+            return usage();
+        *opt = strtoul(argv[++i], NULL, 10);
+        if (!*opt)
+            return usage();
+    }
+
+    if (i < argc){
+        for (; i < argc; i++){
+            struct corpus c;
+            if (!slurp(&c, argv[i])){
+                fprintf(stderr, "benchwrite: cannot read %s\n", argv[i]);
+                free(c.b);
+                return EXIT_FAILURE;
+            }
+            report(&c);
+            free(c.b);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    static const struct{
+        const char *name;
+        size_t (*make)(char *b);
+    } gens[] ={
+        {"ascii log", buildlog},
+        {"escape-heavy", escapes},
+        {"utf-8 text", utf8text},
+        {"cjk/emoji", cjktext}
+    };
+    struct corpus c = {NULL, malloc(CORPUS), 0};
+    if (!c.b)
+        return EXIT_FAILURE;
+    for (size_t g = 0; g < sizeof(gens) / sizeof(gens[0]); g++){
+        c.name = gens[g].name;
+        c.n = gens[g].make(c.b);
+        report(&c);
+    }
+    free(c.b);
+    return EXIT_SUCCESS;
+}
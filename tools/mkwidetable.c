@@ -0,0 +1,370 @@
+/* mkwidetable - generate wide_table.h, the Unicode property trie used by
+ * wide_lookup.c.
+ *
+ * Usage: cc -o mkwidetable tools/mkwidetable.c
+ *        ./mkwidetable [-v version] [-l] ucd-dir > wide_table.h
+ *
+ * ucd-dir holds EastAsianWidth.txt and either DerivedGeneralCategory.txt
+ * or UnicodeData.txt from https://www.unicode.org/Public/<version>/ucd/.
+ * -v refuses files from any other version, and supplies the version when
+ * the files don't name one. -l prints the merged property ranges instead
+ * of the table, which makes it easy to diff two Unicode versions.
+ *
+ * Every code point gets one byte of properties: whether it is full width
+ * normally and in an East Asian context, and what kind of mark it is.
+ * The bytes are stored as a three-stage trie: the top bits of the code
+ * point pick a stage 2 block, the middle bits pick a stage 3 block, and
+ * the low bits pick the byte. Identical blocks are shared, which is what
+ * keeps the whole table small enough to stay in cache.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../wide_lookup.h"
+
+#define NCODES  0x110000
+#define SHIFT1  10
+#define SHIFT2  5
+#define BLOCK2  (1 << (SHIFT1 - SHIFT2))
+#define BLOCK3  (1 << SHIFT2)
+
+static unsigned char props[NCODES];
+static const char * want_version;
+static char version[32];
+
+enum { EAW_NONE, EAW_AMBIGUOUS, EAW_WIDE, EAW_UNSET = 0xff };
+
+/* Unassigned code points in these blocks default to W. EastAsianWidth.txt
+ * has said so in "@missing" lines since 15.1; older files only say it in
+ * prose, so fall back to this list when a file has no W defaults of its own.
+ */
+static const struct {
+	uint32_t start;
+	uint32_t end;
+} default_wide[] = {
+	{ 0x3400, 0x4DBF },
+	{ 0x4E00, 0x9FFF },
+	{ 0xF900, 0xFAFF },
+	{ 0x20000, 0x2FFFD },
+	{ 0x30000, 0x3FFFD },
+};
+
+static void
+die(const char * fmt, const char * arg) {
+	fprintf(stderr, "mkwidetable: ");
+	fprintf(stderr, fmt, arg);
+	fprintf(stderr, "\n");
+	exit(EXIT_FAILURE);
+}
+
+static FILE *
+open_ucd(const char * dir, const char * name) {
+	char path[4096];
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	return fopen(path, "r");
+}
+
+/* The first line of most UCD files is "# Name-X.Y.Z.txt". Check the
+ * version against -v and against the other files.
+ */
+static void
+check_version(const char * line, const char * name) {
+	size_t len = strlen(name);
+	if (strncmp(line, "# ", 2) != 0 || strncmp(line + 2, name, len) != 0 || line[2 + len] != '-') {
+		return;
+	}
+	const char * v = line + 3 + len;
+	size_t n = strcspn(v, "\r\n");
+	if (n > 4 && strncmp(v + n - 4, ".txt", 4) == 0) {
+		n -= 4;
+	}
+	if (n == 0 || n >= sizeof(version)) {
+		return;
+	}
+	char found[sizeof(version)];
+	memcpy(found, v, n);
+	found[n] = '\0';
+	if (want_version && strcmp(found, want_version) != 0) {
+		fprintf(stderr, "mkwidetable: %s.txt is version %s, not %s\n", name, found, want_version);
+		exit(EXIT_FAILURE);
+	}
+	if (version[0] && strcmp(found, version) != 0) {
+		fprintf(stderr, "mkwidetable: %s.txt is version %s, other files are %s\n", name, found, version);
+		exit(EXIT_FAILURE);
+	}
+	strcpy(version, found);
+}
+
+static char *
+trim(char * s) {
+	while (*s == ' ' || *s == '\t') {
+		s++;
+	}
+	size_t n = strlen(s);
+	while (n && strchr(" \t\r\n", s[n - 1])) {
+		s[--n] = '\0';
+	}
+	return s;
+}
+
+/* Parse "XXXX" or "XXXX..YYYY". */
+static int
+parse_range(const char * s, uint32_t * lo, uint32_t * hi) {
+	char * end;
+	*lo = *hi = strtoul(s, &end, 16);
+	if (end == s) {
+		return 0;
+	}
+	if (strncmp(end, "..", 2) == 0) {
+		*hi = strtoul(end + 2, &end, 16);
+	}
+	return *lo <= *hi && *hi < NCODES;
+}
+
+/* Split a "range ; value # comment" line. Returns the value, or NULL if
+ * the line holds no data.
+ */
+static char *
+parse_line(char * line, uint32_t * lo, uint32_t * hi) {
+	line[strcspn(line, "#")] = '\0';
+	char * semi = strchr(line, ';');
+	if (!semi) {
+		return NULL;
+	}
+	*semi = '\0';
+	if (!parse_range(trim(line), lo, hi)) {
+		return NULL;
+	}
+	return trim(semi + 1);
+}
+
+static unsigned char
+eaw_class(const char * v) {
+	if (strcmp(v, "W") == 0 || strcmp(v, "F") == 0) {
+		return EAW_WIDE;
+	}
+	return strcmp(v, "A") == 0 ? EAW_AMBIGUOUS : EAW_NONE;
+}
+
+static unsigned char
+mark_class(const char * gc) {
+	if (strcmp(gc, "Mn") == 0 || strcmp(gc, "Me") == 0) {
+		return TMT_MARK;
+	}
+	if (strcmp(gc, "Mc") == 0) {
+		return TMT_MARK_FULLWIDTH;
+	}
+	return strcmp(gc, "Cf") == 0 ? TMT_FORMAT : TMT_NOT_MARK;
+}
+
+/* Width: W and F are full width everywhere, A only in an East Asian
+ * context. Explicit entries win over "@missing" defaults.
+ */
+static void
+read_east_asian_width(const char * dir) {
+	static unsigned char fallback[NCODES];
+	static unsigned char eaw[NCODES];
+	char line[1024];
+	int have_wide_default = 0;
+	FILE * f = open_ucd(dir, "EastAsianWidth.txt");
+	if (!f) {
+		die("can't open %s/EastAsianWidth.txt", dir);
+	}
+	memset(eaw, EAW_UNSET, sizeof(eaw));
+	for (int first = 1; fgets(line, sizeof(line), f); first = 0) {
+		uint32_t lo, hi;
+		char * v;
+		if (first) {
+			check_version(line, "EastAsianWidth");
+		}
+		if (strncmp(line, "# @missing:", 11) == 0) {
+			if ((v = parse_line(line + 11, &lo, &hi))) {
+				unsigned char w = eaw_class(v);
+				have_wide_default |= (w == EAW_WIDE);
+				memset(fallback + lo, w, hi - lo + 1);
+			}
+		} else if ((v = parse_line(line, &lo, &hi))) {
+			memset(eaw + lo, eaw_class(v), hi - lo + 1);
+		}
+	}
+	fclose(f);
+	if (!have_wide_default) {
+		for (size_t i = 0; i < sizeof(default_wide) / sizeof(default_wide[0]); i++) {
+			memset(fallback + default_wide[i].start, EAW_WIDE, default_wide[i].end - default_wide[i].start + 1);
+		}
+	}
+	for (uint32_t c = 0; c < NCODES; c++) {
+		unsigned char w = (eaw[c] == EAW_UNSET) ? fallback[c] : eaw[c];
+		if (w == EAW_WIDE) {
+			props[c] |= WIDE_PROP_WIDE | WIDE_PROP_WIDE_EA;
+		} else if (w == EAW_AMBIGUOUS) {
+			props[c] |= WIDE_PROP_WIDE_EA;
+		}
+	}
+}
+
+/* Marks: Mn and Me are zero width, Mc takes a cell of its own, Cf is a
+ * formatter. Prefer DerivedGeneralCategory.txt, whose ranges are already
+ * merged; UnicodeData.txt lists large blocks as First/Last pairs instead.
+ */
+static void
+read_general_category(const char * dir) {
+	char line[1024];
+	uint32_t lo, hi;
+	char * v;
+	FILE * f = open_ucd(dir, "DerivedGeneralCategory.txt");
+	if (f) {
+		for (int first = 1; fgets(line, sizeof(line), f); first = 0) {
+			if (first) {
+				check_version(line, "DerivedGeneralCategory");
+			}
+			if ((v = parse_line(line, &lo, &hi))) {
+				unsigned char m = mark_class(v);
+				for (uint32_t c = lo; c <= hi; c++) {
+					props[c] |= m << WIDE_PROP_MARK_SHIFT;
+				}
+			}
+		}
+		fclose(f);
+		return;
+	}
+	if (!(f = open_ucd(dir, "UnicodeData.txt"))) {
+		die("can't open %s/DerivedGeneralCategory.txt or UnicodeData.txt", dir);
+	}
+	uint32_t range_start = NCODES;
+	while (fgets(line, sizeof(line), f)) {
+		char * name = strchr(line, ';');
+		char * gc = name ? strchr(name + 1, ';') : NULL;
+		if (!gc || !parse_range(line, &lo, &hi)) {
+			continue;
+		}
+		*gc++ = '\0';
+		gc[strcspn(gc, ";")] = '\0';
+		if (strstr(name, ", First>")) {
+			range_start = lo;
+			continue;
+		}
+		if (strstr(name, ", Last>") && range_start < lo) {
+			lo = range_start;
+		}
+		range_start = NCODES;
+		unsigned char m = mark_class(gc);
+		for (uint32_t c = lo; c <= hi; c++) {
+			props[c] |= m << WIDE_PROP_MARK_SHIFT;
+		}
+	}
+	fclose(f);
+}
+
+/* Print the merged ranges, one line per run of identical properties. */
+static void
+list_props(void) {
+	static const char * marks[] = { "", " mark", " mark_fullwidth", " format" };
+	for (uint32_t lo = 0, hi; lo < NCODES; lo = hi + 1) {
+		for (hi = lo; hi + 1 < NCODES && props[hi + 1] == props[lo]; hi++)
+			;
+		if (!props[lo]) {
+			continue;
+		}
+		printf("%04X..%04X ;%s%s%s\n", lo, hi,
+		       (props[lo] & WIDE_PROP_WIDE) ? " wide" : "",
+		       (props[lo] & WIDE_PROP_WIDE_EA) ? " wide_ea" : "",
+		       marks[WIDE_PROP_MARK(props[lo])]);
+	}
+}
+
+/* Find block b of the given size in blocks, appending it if it's new. */
+static size_t
+intern_block(void * blocks, size_t * nblocks, const void * b, size_t size) {
+	for (size_t i = 0; i < *nblocks; i++) {
+		if (memcmp((char *)blocks + i * size, b, size) == 0) {
+			return i;
+		}
+	}
+	memcpy((char *)blocks + *nblocks * size, b, size);
+	return (*nblocks)++;
+}
+
+static void
+emit(const char * name, const char * type, const void * data, size_t n, size_t width) {
+	printf("static const %s %s[%zu] = {", type, name, n);
+	for (size_t i = 0; i < n; i++) {
+		unsigned long v = (width == 1) ? ((const uint8_t *)data)[i] : ((const uint16_t *)data)[i];
+		printf("%s%s%lu", i ? "," : "", (i % 16) ? " " : "\n    ", v);
+	}
+	printf("\n};\n\n");
+}
+
+static void
+usage(void) {
+	fprintf(stderr, "usage: mkwidetable [-v version] [-l] ucd-dir\n");
+	exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char ** argv) {
+	static uint8_t stage1[NCODES >> SHIFT1];
+	static uint16_t stage2[(NCODES >> SHIFT1) * BLOCK2];
+	static uint8_t stage3[(NCODES >> SHIFT2) * BLOCK3];
+	size_t n2 = 0;
+	size_t n3 = 0;
+
+	int list = 0;
+	int i;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if (strcmp(argv[i], "-l") == 0) {
+			list = 1;
+		} else if (strcmp(argv[i], "-v") == 0 && i + 1 < argc) {
+			want_version = argv[++i];
+		} else {
+			usage();
+		}
+	}
+	if (i + 1 != argc) {
+		usage();
+	}
+	read_east_asian_width(argv[i]);
+	read_general_category(argv[i]);
+	if (!version[0]) {
+		if (!want_version) {
+			die("%s names no Unicode version; pass -v", argv[i]);
+		}
+		snprintf(version, sizeof(version), "%s", want_version);
+	}
+	if (list) {
+		list_props();
+		return EXIT_SUCCESS;
+	}
+
+	for (uint32_t hi = 0; hi < (NCODES >> SHIFT1); hi++) {
+		uint16_t block2[BLOCK2];
+		for (uint32_t mid = 0; mid < BLOCK2; mid++) {
+			uint32_t base = (hi << SHIFT1) | (mid << SHIFT2);
+			size_t b = intern_block(stage3, &n3, props + base, BLOCK3);
+			if (b > UINT16_MAX) {
+				fprintf(stderr, "mkwidetable: too many stage 3 blocks\n");
+				return EXIT_FAILURE;
+			}
+			block2[mid] = (uint16_t)b;
+		}
+		size_t b = intern_block(stage2, &n2, block2, sizeof(block2));
+		if (b > UINT8_MAX) {
+			fprintf(stderr, "mkwidetable: too many stage 2 blocks\n");
+			return EXIT_FAILURE;
+		}
+		stage1[hi] = (uint8_t)b;
+	}
+
+	printf("/* Generated by tools/mkwidetable.c from Unicode %s; do not edit.\n", version);
+	printf(" * %zu stage 2 blocks, %zu stage 3 blocks, %zu bytes in all.\n */\n\n",
+	       n2, n3, sizeof(stage1) + n2 * BLOCK2 * sizeof(uint16_t) + n3 * BLOCK3);
+	printf("#define WIDE_TABLE_UNICODE_VERSION \"%s\"\n", version);
+	printf("#define WIDE_TABLE_SHIFT1 %d\n", SHIFT1);
+	printf("#define WIDE_TABLE_SHIFT2 %d\n\n", SHIFT2);
+	emit("wide_stage1", "uint8_t", stage1, NCODES >> SHIFT1, 1);
+	emit("wide_stage2", "uint16_t", stage2, n2 * BLOCK2, 2);
+	emit("wide_stage3", "uint8_t", stage3, n3 * BLOCK3, 1);
+	return EXIT_SUCCESS;
+}
@@ -1,5 +1,6 @@
 
 #include "u8mbtowc.h"
+#include "byte_scan.h"
 #include <stdio.h>
 
 int
@@ -104,3 +105,96 @@ utf8_to_wc(tmt_wchar_t * dest, const char * src, size_t src_len, struct utf8_sta
 
 	return UTF8_INCOMPLETE;
 }
+
+static int
+utf8_seq_len(unsigned char lead) {
+	if (lead < 0x80) return 1;
+	if (lead < 0xc2) return 0;
+	if (lead < 0xe0) return 2;
+	if (lead < 0xf0) return 3;
+	if (lead < 0xf5) return 4;
+	return 0;
+}
+
+/* Is cur acceptable as byte pos of the sequence starting with lead?
+ * The second byte is restricted further to rule out overlong forms,
+ * surrogates and code points past U+10FFFF.
+ */
+static int
+utf8_cont_ok(unsigned char lead, int pos, unsigned char cur) {
+	unsigned char lo = 0x80;
+	unsigned char hi = 0xbf;
+	if (pos == 1) {
+		switch (lead) {
+			case 0xe0: lo = 0xa0; break;
+			case 0xed: hi = 0x9f; break;
+			case 0xf0: lo = 0x90; break;
+			case 0xf4: hi = 0x8f; break;
+		}
+	}
+	return (cur >= lo) && (cur <= hi);
+}
+
+static tmt_wchar_t
+utf8_assemble(const unsigned char * data, int len) {
+	switch (len) {
+		case 2:
+			return ((data[0] & 0x1f) << 6) | (data[1] & 0x3f);
+		case 3:
+			return ((data[0] & 0x0f) << 12) | ((data[1] & 0x3f) << 6) | (data[2] & 0x3f);
+		default:
+			return ((data[0] & 0x07) << 18) | ((data[1] & 0x3f) << 12) | ((data[2] & 0x3f) << 6) | (data[3] & 0x3f);
+	}
+}
+
+/* Decode src into at most dest_len code points. Ill-formed input is
+ * replaced by TMT_INVALID_CHAR, and a byte that breaks off a sequence is
+ * then decoded in its own right. A sequence cut short by the end of src
+ * is kept in state and completed by the next call. Returns the number of
+ * code points stored; *consumed gets the number of bytes used, which is
+ * less than src_len only when dest fills up. Only the search for ASCII
+ * runs is vectorised; multibyte sequences are checked a byte at a time.
+ */
+size_t
+utf8_to_wc_n(tmt_wchar_t * dest, size_t dest_len, const char * src, size_t src_len, struct utf8_state * state, size_t * consumed) {
+	size_t n = 0;
+	size_t i = 0;
+	while ((i < src_len) && (n < dest_len)) {
+		unsigned char cur;
+		if (state->pos == 0) {
+			size_t run = scan_ascii(src + i, src_len - i);
+			if (run > dest_len - n) {
+				run = dest_len - n;
+			}
+			for (size_t j = 0; j < run; j++) {
+				dest[n++] = (unsigned char)src[i + j];
+			}
+			i += run;
+			if ((i == src_len) || (n == dest_len)) {
+				break;
+			}
+			cur = src[i++];
+			if (utf8_seq_len(cur) == 0) {
+				dest[n++] = TMT_INVALID_CHAR;
+			} else {
+				state->data[0] = cur;
+				state->pos = 1;
+			}
+			continue;
+		}
+		cur = src[i];
+		if (!utf8_cont_ok(state->data[0], state->pos, cur)) {
+			state->pos = 0;
+			dest[n++] = TMT_INVALID_CHAR;
+			continue;
+		}
+		i++;
+		state->data[state->pos++] = cur;
+		if (state->pos == utf8_seq_len(state->data[0])) {
+			dest[n++] = utf8_assemble(state->data, state->pos);
+			state->pos = 0;
+		}
+	}
+	*consumed = i;
+	return n;
+}
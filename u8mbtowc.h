@@ -13,5 +13,6 @@ struct utf8_state {
 
 int utf8_to_wc(tmt_wchar_t * dest, const char * src, size_t src_len, struct utf8_state * state);
 int wc_to_utf8(char * dest, size_t dest_len, tmt_wchar_t src);
+size_t utf8_to_wc_n(tmt_wchar_t * dest, size_t dest_len, const char * src, size_t src_len, struct utf8_state * state, size_t * consumed);
 
 #endif
@@ -13,6 +13,13 @@ enum tmt_mark {
 
 typedef enum tmt_mark tmt_mark_t;
 
+/* Per-code-point properties as returned by get_wc_unicode_props() */
+#define WIDE_PROP_WIDE        0x01 /* full width                          */
+#define WIDE_PROP_WIDE_EA     0x02 /* full width in an East Asian context */
+#define WIDE_PROP_MARK_SHIFT  2    /* tmt_mark_t in bits 2-3              */
+#define WIDE_PROP_MARK(p)     ((tmt_mark_t)(((p) >> WIDE_PROP_MARK_SHIFT) & 0x03))
+
+unsigned char get_wc_unicode_props(tmt_wchar_t wc);
 bool is_wc_unicode_full_width(tmt_wchar_t wc, bool is_east_asia);
 tmt_mark_t get_wc_unicode_mark_type(tmt_wchar_t wc);
 